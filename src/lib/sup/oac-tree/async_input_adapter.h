@@ -34,7 +34,9 @@
 #include <future>
 #include <map>
 #include <mutex>
+#include <set>
 #include <utility>
+#include <vector>
 
 namespace sup
 {
@@ -47,7 +49,17 @@ public:
   using InputFunction = std::function<UserInputReply(const UserInputRequest&, sup::dto::uint64)>;
   using InterruptFunction = std::function<void(sup::dto::uint64)>;
   class Future;
-  explicit AsyncInputAdapter(InputFunction input_func, InterruptFunction interrupt_func);
+  /**
+   * @brief Constructor.
+   *
+   * @param input_func Blocking function that handles a single user input request.
+   * @param interrupt_func Function that interrupts the user input request with the given id.
+   * @param max_concurrent_requests Maximum number of requests that are handled concurrently, i.e.
+   * the number of threads that may call input_func at the same time. The default of one handles
+   * the requests strictly in order.
+   */
+  explicit AsyncInputAdapter(InputFunction input_func, InterruptFunction interrupt_func,
+                             sup::dto::uint32 max_concurrent_requests = 1);
   ~AsyncInputAdapter();
 
   // return a future that can be used to check if the result is ready and get it
@@ -56,7 +68,7 @@ public:
 private:
   using RequestEntry = std::pair<sup::dto::uint64, UserInputRequest>;
 
-  // Handle all requests in a single thread.
+  // Handle requests from the queue. Each handler thread runs this function.
   void HandleRequestQueue();
 
   // Create a new input request id
@@ -78,9 +90,9 @@ private:
   InterruptFunction m_interrupt_func;
   std::deque<RequestEntry> m_request_queue;
   std::map<sup::dto::uint64, UserInputReply> m_replies;
-  sup::dto::uint64 m_current_id;
+  std::set<sup::dto::uint64> m_active_ids;
   sup::dto::uint64 m_last_request_id;
-  std::future<void> m_handler_future;
+  std::vector<std::future<void>> m_handler_futures;
   mutable std::mutex m_mtx;
   std::condition_variable m_cv;
   std::condition_variable m_reply_cv;
@@ -33,33 +33,44 @@ namespace sup
 namespace oac_tree
 {
 
-AsyncInputAdapter::AsyncInputAdapter(InputFunction input_func, InterruptFunction interrupt_func)
+AsyncInputAdapter::AsyncInputAdapter(InputFunction input_func, InterruptFunction interrupt_func,
+                                     sup::dto::uint32 max_concurrent_requests)
   : m_input_func{std::move(input_func)}
   , m_interrupt_func{std::move(interrupt_func)}
   , m_request_queue{}
   , m_replies{}
-  , m_current_id{0}
+  , m_active_ids{}
   , m_last_request_id{0}
-  , m_handler_future{}
+  , m_handler_futures{}
   , m_mtx{}
   , m_cv{}
   , m_reply_cv{}
   , m_halt{false}
 {
-  m_handler_future = std::async(std::launch::async, &AsyncInputAdapter::HandleRequestQueue, this);
+  const auto n_handlers = std::max(max_concurrent_requests, sup::dto::uint32{1});
+  for (sup::dto::uint32 i = 0; i < n_handlers; ++i)
+  {
+    m_handler_futures.push_back(
+      std::async(std::launch::async, &AsyncInputAdapter::HandleRequestQueue, this));
+  }
 }
 
 AsyncInputAdapter::~AsyncInputAdapter()
 {
   {
     std::lock_guard<std::mutex> lk{m_mtx};
-    if (m_current_id != 0)
+    for (auto id : m_active_ids)
     {
-      m_interrupt_func(m_current_id);
+      m_interrupt_func(id);
     }
     m_halt = true;
   }
-  m_cv.notify_one();
+  m_cv.notify_all();
+  // Join the handler threads before the synchronization primitives they use are destroyed:
+  for (auto& handler_future : m_handler_futures)
+  {
+    handler_future.wait();
+  }
 }
 
 std::unique_ptr<IUserInputFuture> AsyncInputAdapter::AddUserInputRequest(
@@ -91,18 +102,18 @@ void AsyncInputAdapter::HandleRequestQueue()
     }
     auto [id, request] = m_request_queue.front();
     m_request_queue.pop_front();
-    m_current_id = id;
+    m_active_ids.insert(id);
     lk.unlock();
-    // If another thread sees the current id as not zero, this thread must be here:
+    // If another thread sees this id as active, this thread must be here:
     auto reply = m_input_func(request, id);
     lk.lock();
-    // If someone has reset the current id, the reply is no longer needed:
-    if (m_current_id == id)
+    // If someone has removed the id from the active ones, the reply is no longer needed:
+    if (m_active_ids.erase(id) > 0)
     {
-      m_replies[m_current_id] = reply;
-      m_reply_cv.notify_one();
+      m_replies[id] = reply;
+      // Notify all, since different futures may be waiting for different replies:
+      m_reply_cv.notify_all();
     }
-    m_current_id = 0;
   }
 }
 
@@ -185,11 +196,10 @@ void AsyncInputAdapter::CancelInputRequest(const Future& token)
     m_replies.erase(reply_it);
     return;
   }
-  if (m_current_id == id)
+  if (m_active_ids.erase(id) > 0)
   {
-    // Here, we need to signal the current request to interrupt and to not publish its result
+    // Here, we need to signal the active request to interrupt and to not publish its result
     m_interrupt_func(id);
-    m_current_id = 0;
   }
 }
 
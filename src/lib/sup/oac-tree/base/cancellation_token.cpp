@@ -0,0 +1,152 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/oac-tree/cancellation_token.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Remaining time that is spent spinning instead of sleeping at the end of a precise wait.
+const std::chrono::microseconds kFinalSpinDuration{100};
+}  // unnamed namespace
+
+namespace sup
+{
+namespace oac_tree
+{
+
+struct CancellationToken::State
+{
+  std::atomic<bool> m_cancelled{false};
+  std::shared_ptr<State> m_parent{};
+  std::mutex m_mtx{};
+  std::size_t m_next_id{0};
+  std::map<std::size_t, std::function<void()>> m_callbacks{};
+};
+
+CancellationToken::CancellationToken()
+  : m_state{std::make_shared<State>()}
+{}
+
+CancellationToken::~CancellationToken() = default;
+
+CancellationToken::CancellationToken(const CancellationToken& other) = default;
+
+CancellationToken& CancellationToken::operator=(const CancellationToken& other) = default;
+
+void CancellationToken::SetParent(const CancellationToken& parent)
+{
+  m_state->m_parent = parent.m_state;
+}
+
+bool CancellationToken::IsCancelled() const
+{
+  for (auto state = m_state.get(); state != nullptr; state = state->m_parent.get())
+  {
+    if (state->m_cancelled.load())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CancellationToken::Cancel()
+{
+  m_state->m_cancelled.store(true);
+  std::lock_guard<std::mutex> lk{m_state->m_mtx};
+  for (const auto& [id, cb] : m_state->m_callbacks)
+  {
+    cb();
+  }
+}
+
+void CancellationToken::Clear()
+{
+  m_state->m_cancelled.store(false);
+}
+
+ScopeGuard CancellationToken::RegisterWakeCallback(std::function<void()> cb) const
+{
+  // Registering the callback with all ancestors makes cancellation O(number of waiters), instead
+  // of having to walk the subtree below the cancelled token.
+  std::vector<std::pair<std::shared_ptr<State>, std::size_t>> registrations;
+  for (auto state = m_state; state; state = state->m_parent)
+  {
+    std::lock_guard<std::mutex> lk{state->m_mtx};
+    auto id = state->m_next_id++;
+    state->m_callbacks[id] = cb;
+    registrations.emplace_back(state, id);
+  }
+  return ScopeGuard{[registrations]() {
+    for (const auto& [state, id] : registrations)
+    {
+      std::lock_guard<std::mutex> lk{state->m_mtx};
+      state->m_callbacks.erase(id);
+    }
+  }};
+}
+
+bool CancellationToken::WaitUntil(std::chrono::steady_clock::time_point deadline) const
+{
+  std::mutex mtx;
+  std::condition_variable cv;
+  bool woken = false;
+  // The callback is registered before the first check of the predicate, so a cancellation cannot
+  // be missed.
+  auto guard = RegisterWakeCallback([&mtx, &cv, &woken]() {
+    {
+      std::lock_guard<std::mutex> lk{mtx};
+      woken = true;
+    }
+    cv.notify_all();
+  });
+  {
+    std::unique_lock<std::mutex> lk{mtx};
+    (void)cv.wait_until(lk, deadline, [this, &woken]() { return woken || IsCancelled(); });
+  }
+  return IsCancelled();
+}
+
+bool CancellationToken::WaitUntilPrecise(std::chrono::steady_clock::time_point deadline) const
+{
+  if (WaitUntil(deadline - kFinalSpinDuration))
+  {
+    return true;
+  }
+  while (!IsCancelled() && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::yield();
+  }
+  return IsCancelled();
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_CANCELLATION_TOKEN_H_
+#define SUP_OAC_TREE_CANCELLATION_TOKEN_H_
+
+#include <sup/oac-tree/scope_guard.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Token that signals cancellation of a subtree of instructions.
+ *
+ * @details Tokens are linked to the token of their parent, so cancelling a token is immediately
+ * visible to all tokens below it, without walking the subtree. Long-running code can poll
+ * IsCancelled(), block on WaitUntil() or register a callback that wakes it up on cancellation.
+ * Copies of a token share the same state.
+ */
+class CancellationToken
+{
+public:
+  CancellationToken();
+  ~CancellationToken();
+
+  CancellationToken(const CancellationToken& other);
+  CancellationToken& operator=(const CancellationToken& other);
+
+  /**
+   * @brief Link this token to a parent token, so it is cancelled when the parent is.
+   *
+   * @param parent Parent token.
+   *
+   * @note Linking is not thread safe and should happen before the token is used, e.g. during
+   * setup.
+   */
+  void SetParent(const CancellationToken& parent);
+
+  /**
+   * @brief Check if this token or one of its ancestors was cancelled.
+   */
+  bool IsCancelled() const;
+
+  /**
+   * @brief Cancel this token and wake up all waiters on this token and its descendants.
+   */
+  void Cancel();
+
+  /**
+   * @brief Clear the cancellation of this token. Ancestors are not affected.
+   */
+  void Clear();
+
+  /**
+   * @brief Register a callback that will be called when this token gets cancelled, either directly
+   * or through one of its ancestors.
+   *
+   * @param cb Callback function. It is called while internal locks are held and should only
+   * signal the waiting code, e.g. by notifying a condition variable.
+   * @return Guard that unregisters the callback when destroyed.
+   */
+  ScopeGuard RegisterWakeCallback(std::function<void()> cb) const;
+
+  /**
+   * @brief Block until the deadline passes or the token gets cancelled.
+   *
+   * @param deadline Deadline on the steady clock.
+   * @return true when the token was cancelled.
+   */
+  bool WaitUntil(std::chrono::steady_clock::time_point deadline) const;
+
+  /**
+   * @brief Block until the deadline passes or the token gets cancelled, with better accuracy than
+   * WaitUntil.
+   *
+   * @details The thread sleeps until shortly before the deadline and yields for the remaining time,
+   * so the return is not delayed by the wake-up latency of the scheduler.
+   *
+   * @param deadline Deadline on the steady clock.
+   * @return true when the token was cancelled.
+   */
+  bool WaitUntilPrecise(std::chrono::steady_clock::time_point deadline) const;
+
+private:
+  struct State;
+  std::shared_ptr<State> m_state;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_CANCELLATION_TOKEN_H_
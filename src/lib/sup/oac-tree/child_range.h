@@ -0,0 +1,128 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_CHILD_RANGE_H_
+#define SUP_OAC_TREE_CHILD_RANGE_H_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+/**
+ * @brief Non-owning view of the child instructions of an instruction.
+ *
+ * @details The view refers directly to the storage of the parent instruction, so creating and
+ * iterating it does not allocate. It is invalidated when child instructions are inserted or taken
+ * from the parent.
+ */
+template <typename InstructionType>
+class BasicChildRange
+{
+public:
+  class Iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = InstructionType*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = InstructionType**;
+    using reference = InstructionType*;
+
+    explicit Iterator(const std::unique_ptr<Instruction>* ptr)
+      : m_ptr{ptr}
+    {}
+
+    InstructionType* operator*() const { return m_ptr->get(); }
+
+    Iterator& operator++()
+    {
+      ++m_ptr;
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      Iterator result{*this};
+      ++m_ptr;
+      return result;
+    }
+
+    bool operator==(const Iterator& other) const { return m_ptr == other.m_ptr; }
+
+    bool operator!=(const Iterator& other) const { return m_ptr != other.m_ptr; }
+
+  private:
+    const std::unique_ptr<Instruction>* m_ptr;
+  };
+
+  BasicChildRange()
+    : m_first{nullptr}
+    , m_size{0}
+  {}
+
+  BasicChildRange(const std::unique_ptr<Instruction>* first, std::size_t size)
+    : m_first{first}
+    , m_size{size}
+  {}
+
+  /**
+   * @brief Conversion from a range of non-const instructions to a range of const instructions.
+   */
+  template <typename OtherType,
+            typename = std::enable_if_t<std::is_convertible<OtherType*, InstructionType*>::value>>
+  BasicChildRange(const BasicChildRange<OtherType>& other)
+    : m_first{other.data()}
+    , m_size{other.size()}
+  {}
+
+  Iterator begin() const { return Iterator{m_first}; }
+
+  Iterator end() const { return Iterator{m_first + m_size}; }
+
+  std::size_t size() const { return m_size; }
+
+  bool empty() const { return m_size == 0; }
+
+  InstructionType* operator[](std::size_t idx) const { return m_first[idx].get(); }
+
+  const std::unique_ptr<Instruction>* data() const { return m_first; }
+
+private:
+  const std::unique_ptr<Instruction>* m_first;
+  std::size_t m_size;
+};
+
+using ChildRange = BasicChildRange<Instruction>;
+using ConstChildRange = BasicChildRange<const Instruction>;
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_CHILD_RANGE_H_
@@ -62,6 +62,20 @@ protected:
    */
   bool HasChildren() const;
 
+  /**
+   * @brief Get the number of child instructions.
+   */
+  std::size_t NumberOfChildren() const;
+
+  /**
+   * @brief Get the child instruction at the given index, without building a list of children.
+   *
+   * @param idx Index of the child instruction, which needs to be smaller than NumberOfChildren().
+   * @return Pointer to the child instruction.
+   */
+  Instruction* ChildAt(std::size_t idx);
+  const Instruction* ChildAt(std::size_t idx) const;
+
   /**
    * @brief Call Instruction::Reset() on all child instructions.
    */
@@ -75,7 +89,9 @@ protected:
 private:
   void ResetHook(UserInterface& ui) override;
   void HaltImpl() override;
-  std::vector<const Instruction *> ChildInstructionsImpl() const override;
+  ChildRange ChildrenImpl() const override;
+  bool IsNonBlockingImpl() const override;
+  bool CompletesSynchronouslyImpl() const override;
   int ChildrenCountImpl() const override;
   bool InsertInstructionImpl(std::unique_ptr<Instruction>&& child, int index) override;
   std::unique_ptr<Instruction> TakeInstructionImpl(int index) override;
@@ -38,6 +38,13 @@ namespace DefaultSettings
  */
 const sup::dto::int64 DEFAULT_SLEEP_TIME_NS = 100000000; // 100 ms
 
+/**
+ * @brief Default maximum number of execution steps in a single tick.
+ *
+ * @note A value of one disables running to block: each tick executes exactly one step.
+ */
+const sup::dto::uint32 DEFAULT_MAX_MICRO_TICKS = 1;
+
 /**
  * @brief Default value (in ns) for the maximum time an instruction should block.
  *
@@ -140,11 +147,26 @@ const std::string EQUALS_VARIABLE_NAME_ATTRIBUTE_NAME = "equalsVar";
 const std::string VARIABLE_TYPE_ATTRIBUTE_NAME = "varType";
 const std::string MEMBER_NAME_ATTRIBUTE_NAME = "memberName";
 const std::string BLOCKING_ATTRIBUTE_NAME = "blocking";
+const std::string EXECUTION_MODE_ATTRIBUTE_NAME = "executionMode";
+const std::string MAX_CONCURRENCY_ATTRIBUTE_NAME = "maxConcurrency";
+const std::string START_ATTRIBUTE_NAME = "start";
+const std::string STOP_ATTRIBUTE_NAME = "stop";
+const std::string STEP_ATTRIBUTE_NAME = "step";
+const std::string EXPRESSION_ATTRIBUTE_NAME = "expression";
+const std::string ARRAY_MODE_ATTRIBUTE_NAME = "arrayMode";
+const std::string INPUT_VARIABLE_NAMES_ATTRIBUTE_NAME = "inputVars";
+const std::string OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME = "outputVars";
+const std::string TRANSACTIONAL_ATTRIBUTE_NAME = "transactional";
+const std::string PERIOD_SEC_ATTRIBUTE_NAME = "period";
+const std::string PHASE_SEC_ATTRIBUTE_NAME = "phase";
+const std::string OVERRUN_POLICY_ATTRIBUTE_NAME = "overrunPolicy";
+const std::string STATISTICS_VARIABLE_NAME_ATTRIBUTE_NAME = "statsVar";
 
 // Variable attribute names
 const std::string TYPE_ATTRIBUTE_NAME = "type";
 const std::string VALUE_ATTRIBUTE_NAME = "value";
 const std::string IS_DYNAMIC_TYPE_ATTRIBUTE_NAME = "dynamicType";
+const std::string READ_MOSTLY_ATTRIBUTE_NAME = "readMostly";
 const std::string PRETTY_JSON_ATTRIBUTE_NAME = "pretty";
 
 // Instruction info node fields
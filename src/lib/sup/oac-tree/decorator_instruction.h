@@ -89,10 +89,33 @@ protected:
    */
   void HaltChild();
 
+  /**
+   * @brief Check if the child instruction is present and non-blocking.
+   *
+   * @details Decorators that only forward single ticks to their child can use this to opt in to
+   * non-blocking execution. The default for decorators is blocking, since a decorator may block
+   * the calling thread itself, independently of its child.
+   *
+   * @return true when the child is present and non-blocking.
+   */
+  bool IsChildNonBlocking() const;
+
+  /**
+   * @brief Check if the child instruction is present and completes synchronously.
+   *
+   * @details Decorators that finish as soon as their child finishes can use this to opt in to
+   * synchronous completion.
+   *
+   * @return true when the child is present and completes synchronously.
+   */
+  bool ChildCompletesSynchronously() const;
+
 private:
   void ResetHook(UserInterface& ui) override;
   void HaltImpl() override;
-  std::vector<const Instruction*> ChildInstructionsImpl() const override;
+  ChildRange ChildrenImpl() const override;
+  bool IsNonBlockingImpl() const override;
+  bool CompletesSynchronouslyImpl() const override;
   std::vector<const Instruction*> NextInstructionsImpl() const override;
   int ChildrenCountImpl() const override;
   bool InsertInstructionImpl(std::unique_ptr<Instruction>&& child, int index) override;
@@ -135,6 +135,18 @@ public:
    */
   virtual void Interrupt(sup::dto::uint64 id) = 0;
 
+  /**
+   * @brief Maximum number of user input requests (GetUserValue/GetUserChoice) that may be
+   * outstanding at the same time.
+   *
+   * @details Implementations that match concurrent blocking input calls by their id can override
+   * this to allow e.g. parallel branches to wait for user input simultaneously. The default
+   * implementation returns one, meaning that input requests are forwarded one at a time.
+   *
+   * @return Maximum number of concurrent user input requests (at least one).
+   */
+  virtual sup::dto::uint32 GetMaxConcurrentUserInputs() const;
+
   /**
    * @brief Ouput a message to the user.
    *
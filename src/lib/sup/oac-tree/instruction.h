@@ -24,9 +24,11 @@
 #define SUP_OAC_TREE_INSTRUCTION_H_
 
 #include <atomic>
-#include <mutex>
+#include <functional>
 
 #include <sup/oac-tree/attribute_handler.h>
+#include <sup/oac-tree/cancellation_token.h>
+#include <sup/oac-tree/child_range.h>
 #include <sup/oac-tree/execution_status.h>
 #include <sup/oac-tree/user_interface.h>
 
@@ -125,6 +127,8 @@ public:
    * This method only sets an atomic boolean member variable. It is up to implementations
    * of the Instruction to check this variable regularly to prevent long blocking. It is
    * expected that an instruction will fail if it is interrupted (status: FAILURE).
+   * The instruction's cancellation token is cancelled before the halt is propagated to child
+   * instructions, so blocking code in the whole subtree can be woken up immediately.
    */
   void Halt();
 
@@ -267,6 +271,25 @@ public:
    */
   std::vector<const Instruction*> ChildInstructions() const;
 
+  /**
+   * @brief Get a view of the child instructions.
+   *
+   * @return Range of child instructions.
+   *
+   * @note Unlike ChildInstructions, this does not allocate a list. The range is invalidated by
+   * inserting or taking child instructions. It is only populated by instructions that override
+   * ChildrenImpl (e.g. compound and decorator instructions), so code that walks arbitrary
+   * instruction trees, including plugin instructions, needs to use ChildInstructions.
+   */
+  ChildRange Children();
+
+  /**
+   * @brief Get a view of the child instructions (const version).
+   *
+   * @return Range of child instructions.
+   */
+  ConstChildRange Children() const;
+
   /**
    * @brief Get list of child instructions that will be executed in the next execute step.
    *
@@ -278,6 +301,29 @@ public:
    */
   std::vector<const Instruction*> NextInstructions() const;
 
+  /**
+   * @brief Indicate that a single execution step of this instruction always finishes quickly.
+   *
+   * @return true if ExecuteSingle never blocks, e.g. waiting for time to pass or for user input.
+   *
+   * @details Parent instructions can use this to execute the instruction inline instead of in a
+   * separate thread (see ParallelSequence). Workspace access is considered to be non-blocking.
+   */
+  bool IsNonBlocking() const;
+
+  /**
+   * @brief Indicate that repeated execution steps of this instruction finish without waiting.
+   *
+   * @return true if calling ExecuteSingle repeatedly, without delay in between, reaches a finished
+   * status after a bounded number of calls.
+   *
+   * @details This is stronger than IsNonBlocking: instructions that return RUNNING while waiting
+   * for time to pass, for user input or for other threads are non-blocking, but do not complete
+   * synchronously. Parent instructions can use this to run the instruction to completion within
+   * a single execution step (see AtomicSequence).
+   */
+  bool CompletesSynchronously() const;
+
   /**
    * @brief Inserts child into the given index.
    *
@@ -299,6 +345,14 @@ public:
    */
   bool IsHaltRequested() const;
 
+  /**
+   * @brief Get the cancellation token of this instruction.
+   *
+   * @details The token is cancelled when this instruction or one of its ancestors is halted and is
+   * cleared again on Reset. Long-running or blocking code can poll it or wait on it.
+   */
+  const CancellationToken& GetCancellationToken() const;
+
 protected:
   /**
    * @brief Add an attribute definition with the given name and type.
@@ -325,13 +379,25 @@ protected:
    */
   void AddConstraint(Constraint constraint);
 
+  /**
+   * @brief Link the cancellation token of a child instruction to the token of this instruction.
+   *
+   * @param child Child instruction.
+   *
+   * @note Called during setup of the child instruction.
+   */
+  void LinkCancellationToken(Instruction& child) const;
+
 private:
   /**
    * @brief Typename of this instruction
    */
   const std::string m_type;
 
-  ExecutionStatus m_status;
+  /**
+   * @brief Execution status, stored atomically so it can be read from any thread without locking.
+   */
+  std::atomic<ExecutionStatus> m_status;
 
   ExecutionStatus m_status_before;
   /**
@@ -339,18 +405,16 @@ private:
    */
   std::atomic_bool m_halt_requested;
 
+  /**
+   * @brief Token that is cancelled together with the halt flag and linked to the parent's token.
+   */
+  CancellationToken m_cancel_token;
+
   /**
    * @brief Attribute handler.
   */
  AttributeHandler m_attribute_handler;
 
-  /**
-   * @brief Mutex for thread safe access to the Instruction's execution status.
-   *
-   * @note Only locked for Get/SetStatus to prevent deadlock.
-   */
-  mutable std::mutex m_status_mutex;
-
   /**
    * @brief Set the Instruction's execution status.
    *
@@ -449,9 +513,22 @@ private:
    * @brief Get list of child instructions implementation (const version).
    *
    * @return List of child instructions.
+   *
+   * @note The default implementation builds the list from ChildrenImpl.
    */
   virtual std::vector<const Instruction*> ChildInstructionsImpl() const;
 
+  /**
+   * @brief Get a view of the child instructions implementation.
+   *
+   * @return Range of child instructions.
+   *
+   * @note The default implementation returns an empty range. Instructions that store their
+   * children as a contiguous list of owning pointers can override this to support Children().
+   * ChildInstructionsImpl remains the authoritative list of child instructions.
+   */
+  virtual ChildRange ChildrenImpl() const;
+
   /**
    * @brief Get list of child instructions that will be executed in the next execute step.
    *
@@ -459,6 +536,26 @@ private:
    */
   virtual std::vector<const Instruction*> NextInstructionsImpl() const;
 
+  /**
+   * @brief Indicate that a single execution step of this instruction always finishes quickly.
+   *
+   * @return true if ExecuteSingle never blocks.
+   *
+   * @note The default implementation returns false, so instructions need to opt in explicitly.
+   */
+  virtual bool IsNonBlockingImpl() const;
+
+  /**
+   * @brief Indicate that repeated execution steps of this instruction finish without waiting.
+   *
+   * @return true if repeated calls to ExecuteSingle finish after a bounded number of calls.
+   *
+   * @note The default implementation returns IsNonBlocking(), which holds for leaf instructions
+   * that finish in their first execution step. Instructions that return RUNNING while waiting for
+   * something need to override this.
+   */
+  virtual bool CompletesSynchronouslyImpl() const;
+
   /**
    * @brief Inserts child into the given index.
    *
@@ -553,6 +650,44 @@ bool SetValueFromAttributeName(const Instruction& instruction, Workspace& ws,
                                UserInterface& ui, const std::string& attr_name,
                                const sup::dto::AnyValue& value);
 
+/**
+ * @brief Atomically update variable (and field) with name contained in the instruction's
+ * attribute.
+ *
+ * @param instruction Instruction containing the attribute.
+ * @param ws Workspace containing the variables
+ * @param ui UserInterface to use to report errors or warnings.
+ * @param attr_name Attribute name.
+ * @param func Function that modifies the value passed to it and returns true on success.
+ *
+ * @return True if successful.
+ *
+ * @note Failures of the update function itself are not logged; this is the responsibility of the
+ * caller.
+ */
+bool UpdateValueFromAttributeName(const Instruction& instruction, Workspace& ws,
+                                  UserInterface& ui, const std::string& attr_name,
+                                  const std::function<bool(sup::dto::AnyValue&)>& func);
+
+/**
+ * @brief Atomically update variable (and field) with name contained in the instruction's
+ * attribute, modifying the stored value in place.
+ *
+ * @param instruction Instruction containing the attribute.
+ * @param ws Workspace containing the variables
+ * @param ui UserInterface to use to report errors or warnings.
+ * @param attr_name Attribute name.
+ * @param func Function that modifies the value passed to it and returns true on success. It may
+ * only modify the value when it returns true.
+ *
+ * @return True if successful.
+ *
+ * @note See UpdateValueFromAttributeName and Workspace::UpdateValueInPlace.
+ */
+bool UpdateValueInPlaceFromAttributeName(const Instruction& instruction, Workspace& ws,
+                                         UserInterface& ui, const std::string& attr_name,
+                                         const std::function<bool(sup::dto::AnyValue&)>& func);
+
 /**
  * @brief Construct an anyvalue from a pair of attributes holding the json type and value
  * representation.
@@ -55,51 +55,58 @@ ExecutionStatus AddElement::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   {
     return ExecutionStatus::FAILURE;
   }
-  sup::dto::AnyValue output_var;
-  if (!GetAttributeValue(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, output_var))
-  {
-    return ExecutionStatus::FAILURE;
-  }
 
-  // Check if output_var is an array
-  if (!sup::dto::IsArrayValue(output_var))
+  // The checks are performed on the current value of the output variable, while holding its lock.
+  // The value is only modified when all checks pass, so it can be updated in place.
+  std::string warning_message;
+  auto func = [this, &input_var, &warning_message](sup::dto::AnyValue& output_var)
   {
-    std::string warning_message =
-        InstructionWarningProlog(*this) + " only allowed to insert into an array.";
-    LogWarning(ui, warning_message);
-    return ExecutionStatus::FAILURE;
-  }
+    // Check if output_var is an array
+    if (!sup::dto::IsArrayValue(output_var))
+    {
+      warning_message = InstructionWarningProlog(*this) + " only allowed to insert into an array.";
+      return false;
+    }
 
-  // Check member type
-  if (output_var.GetType().ElementType() != input_var.GetType())
-  {
-    std::string warning_message = InstructionWarningProlog(*this)
-                                + " trying to insert wrong element type: " + input_var.GetTypeName()
-                                + ". Expected: " + output_var.GetType().ElementType().GetTypeName();
-    LogWarning(ui, warning_message);
-    return ExecutionStatus::FAILURE;
-  }
+    // Check member type
+    if (output_var.GetType().ElementType() != input_var.GetType())
+    {
+      warning_message = InstructionWarningProlog(*this)
+                      + " trying to insert wrong element type: " + input_var.GetTypeName()
+                      + ". Expected: " + output_var.GetType().ElementType().GetTypeName();
+      return false;
+    }
 
-  try
-  {
-    output_var.AddElement(input_var);
-  }
-  catch (const sup::dto::InvalidOperationException& e)
-  {
-    const std::string warning = InstructionWarningProlog(*this) + e.what();
-    LogWarning(ui, warning);
-    return ExecutionStatus::FAILURE;
-  }
+    try
+    {
+      output_var.AddElement(input_var);
+    }
+    catch (const sup::dto::InvalidOperationException& e)
+    {
+      warning_message = InstructionWarningProlog(*this) + e.what();
+      return false;
+    }
+    return true;
+  };
 
-  // Add to WS
-  if (!SetValueFromAttributeName(*this, ws, ui, Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME,
-                                 output_var))
+  // Update WS
+  if (!UpdateValueInPlaceFromAttributeName(*this, ws, ui,
+                                           Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME, func))
   {
+    if (!warning_message.empty())
+    {
+      LogWarning(ui, warning_message);
+    }
     return ExecutionStatus::FAILURE;
   }
 
   return ExecutionStatus::SUCCESS;
 }
 
+bool AddElement::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 }  // namespace sup
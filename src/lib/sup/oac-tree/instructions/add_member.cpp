@@ -59,11 +59,6 @@ ExecutionStatus AddMember::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   {
     return ExecutionStatus::FAILURE;
   }
-  sup::dto::AnyValue output_var;
-  if (!GetAttributeValue(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, output_var))
-  {
-    return ExecutionStatus::FAILURE;
-  }
 
   // Get the name we want to assign to the new var
   auto member_name = GetAttributeString(Constants::MEMBER_NAME_ATTRIBUTE_NAME);
@@ -75,53 +70,66 @@ ExecutionStatus AddMember::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
     return ExecutionStatus::FAILURE;
   }
 
-  // Check if output_var is a struct
-  if (!IsStructValue(output_var))
+  // The checks are performed on the current value of the output variable, while holding its lock.
+  // The value is only modified when all checks pass, so it can be updated in place.
+  std::string warning;
+  auto func = [this, &input_var, &member_name, &warning](sup::dto::AnyValue& output_var)
   {
-    const std::string warning =
-        InstructionWarningProlog(*this) + " adding members to non-struct variables is not allowed."
-        + "Output var [" + GetAttributeString(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
-        + "] is not a struct.";
-    LogWarning(ui, warning);
-    return ExecutionStatus::FAILURE;
-  }
+    // Check if output_var is a struct
+    if (!IsStructValue(output_var))
+    {
+      warning =
+          InstructionWarningProlog(*this) + " adding members to non-struct variables is not allowed."
+          + "Output var [" + GetAttributeString(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+          + "] is not a struct.";
+      return false;
+    }
 
-  // Check if output_var already contains a member with the same name
-  auto has_member_with_name = [&member_name](const std::string& name)
-  { return (0 == name.compare(member_name)); };
+    // Check if output_var already contains a member with the same name
+    auto has_member_with_name = [&member_name](const std::string& name)
+    { return (0 == name.compare(member_name)); };
 
-  auto member_names = output_var.MemberNames();
+    auto member_names = output_var.MemberNames();
 
-  if (std::any_of(member_names.begin(), member_names.end(), has_member_with_name))
-  {
-    const std::string warning = InstructionWarningProlog(*this) + " variable ["
-                                + GetAttributeString(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
-                                + "] already has a member called ["
-                                + GetAttributeString(Constants::MEMBER_NAME_ATTRIBUTE_NAME) + "].";
-    LogWarning(ui, warning);
-    return ExecutionStatus::FAILURE;
-  }
+    if (std::any_of(member_names.begin(), member_names.end(), has_member_with_name))
+    {
+      warning = InstructionWarningProlog(*this) + " variable ["
+              + GetAttributeString(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+              + "] already has a member called ["
+              + GetAttributeString(Constants::MEMBER_NAME_ATTRIBUTE_NAME) + "].";
+      return false;
+    }
 
-  // Trying to add a member to a locked struct will throw exception
-  try
-  {
-    output_var.AddMember(member_name, input_var);
-  }
-  catch (const sup::dto::InvalidOperationException& e)
-  {
-    const std::string warning = InstructionWarningProlog(*this) + e.what();
-    LogWarning(ui, warning);
-    return ExecutionStatus::FAILURE;
-  }
+    // Trying to add a member to a locked struct will throw exception
+    try
+    {
+      output_var.AddMember(member_name, input_var);
+    }
+    catch (const sup::dto::InvalidOperationException& e)
+    {
+      warning = InstructionWarningProlog(*this) + e.what();
+      return false;
+    }
+    return true;
+  };
 
-  // Add to WS
-  if (!SetValueFromAttributeName(*this, ws, ui, Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME,
-                                 output_var))
+  // Update WS
+  if (!UpdateValueInPlaceFromAttributeName(*this, ws, ui,
+                                           Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME, func))
   {
+    if (!warning.empty())
+    {
+      LogWarning(ui, warning);
+    }
     return ExecutionStatus::FAILURE;
   }
   return ExecutionStatus::SUCCESS;
 }
 
+bool AddMember::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 }  // namespace sup
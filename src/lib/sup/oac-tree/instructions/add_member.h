@@ -47,6 +47,8 @@ public:
 
 private:
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
 };
 
 }  // namespace oac_tree
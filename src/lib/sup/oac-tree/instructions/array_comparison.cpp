@@ -0,0 +1,329 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "array_comparison.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anytype.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace
+{
+const std::string ARRAY_MODE_ALL = "all";
+const std::string ARRAY_MODE_ANY = "any";
+const std::string ARRAY_MODE_COUNT = "count";
+const std::string ARRAY_MODE_ELEMENTWISE = "elementwise";
+
+enum class BufferType
+{
+  kSigned,
+  kUnsigned,
+  kFloat
+};
+
+bool GetElementTypeCode(const sup::dto::AnyValue& value, sup::dto::TypeCode& type_code);
+bool IsUnsignedTypeCode(sup::dto::TypeCode type_code);
+bool IsFloatTypeCode(sup::dto::TypeCode type_code);
+BufferType CommonBufferType(sup::dto::TypeCode left, sup::dto::TypeCode right);
+
+template <typename T>
+void FillBuffer(const sup::dto::AnyValue& value, std::size_t n_elements, std::vector<T>& buffer);
+
+template <typename T, typename Op>
+void CompareKernel(const T* lhs, const T* rhs, std::size_t n_elements, sup::dto::uint8* result,
+                   Op op);
+
+template <typename T>
+void CompareBuffers(const sup::dto::AnyValue& lhs, const sup::dto::AnyValue& rhs,
+                    std::size_t n_elements, sup::oac_tree::ComparisonOperator op,
+                    std::vector<sup::dto::uint8>& result);
+}  // unnamed namespace
+
+namespace sup
+{
+namespace oac_tree
+{
+
+ArrayComparisonMode ParseArrayComparisonMode(const Instruction& instruction)
+{
+  if (!instruction.HasAttribute(Constants::ARRAY_MODE_ATTRIBUTE_NAME))
+  {
+    if (instruction.HasAttribute(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME))
+    {
+      std::string error_message = InstructionSetupExceptionProlog(instruction) +
+        "attribute [" + Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME + "] requires attribute [" +
+        Constants::ARRAY_MODE_ATTRIBUTE_NAME + "]";
+      throw InstructionSetupException(error_message);
+    }
+    return ArrayComparisonMode::kNone;
+  }
+  auto mode_str = instruction.GetAttributeString(Constants::ARRAY_MODE_ATTRIBUTE_NAME);
+  ArrayComparisonMode mode = ArrayComparisonMode::kNone;
+  if (mode_str == ARRAY_MODE_ALL)
+  {
+    mode = ArrayComparisonMode::kAll;
+  }
+  else if (mode_str == ARRAY_MODE_ANY)
+  {
+    mode = ArrayComparisonMode::kAny;
+  }
+  else if (mode_str == ARRAY_MODE_COUNT)
+  {
+    mode = ArrayComparisonMode::kCount;
+  }
+  else if (mode_str == ARRAY_MODE_ELEMENTWISE)
+  {
+    mode = ArrayComparisonMode::kElementwise;
+  }
+  else
+  {
+    std::string error_message = InstructionSetupExceptionProlog(instruction) +
+      "unknown array mode [" + mode_str + "], expected one of [" + ARRAY_MODE_ALL + ", " +
+      ARRAY_MODE_ANY + ", " + ARRAY_MODE_COUNT + ", " + ARRAY_MODE_ELEMENTWISE + "]";
+    throw InstructionSetupException(error_message);
+  }
+  bool needs_output = mode == ArrayComparisonMode::kCount ||
+                      mode == ArrayComparisonMode::kElementwise;
+  if (needs_output != instruction.HasAttribute(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME))
+  {
+    std::string error_message = InstructionSetupExceptionProlog(instruction) +
+      "attribute [" + Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME + "] is " +
+      (needs_output ? "required" : "not supported") + " for array mode [" + mode_str + "]";
+    throw InstructionSetupException(error_message);
+  }
+  return mode;
+}
+
+bool CompareElementwise(const sup::dto::AnyValue& lhs, const sup::dto::AnyValue& rhs,
+                        ComparisonOperator op, std::vector<sup::dto::uint8>& result,
+                        std::string& error)
+{
+  sup::dto::TypeCode left_type{};
+  sup::dto::TypeCode right_type{};
+  if (!GetElementTypeCode(lhs, left_type) || !GetElementTypeCode(rhs, right_type))
+  {
+    error = "operands need to be numeric arrays or scalars";
+    return false;
+  }
+  const bool left_is_array = sup::dto::IsArrayValue(lhs);
+  const bool right_is_array = sup::dto::IsArrayValue(rhs);
+  const auto n_left = left_is_array ? lhs.NumberOfElements() : 1;
+  const auto n_right = right_is_array ? rhs.NumberOfElements() : 1;
+  if (left_is_array && right_is_array && n_left != n_right)
+  {
+    error = "arrays have different lengths [" + std::to_string(n_left) + "] and [" +
+            std::to_string(n_right) + "]";
+    return false;
+  }
+  const auto n_elements = left_is_array ? n_left : n_right;
+  switch (CommonBufferType(left_type, right_type))
+  {
+  case BufferType::kSigned:
+    CompareBuffers<sup::dto::int64>(lhs, rhs, n_elements, op, result);
+    break;
+  case BufferType::kUnsigned:
+    CompareBuffers<sup::dto::uint64>(lhs, rhs, n_elements, op, result);
+    break;
+  default:
+    CompareBuffers<sup::dto::float64>(lhs, rhs, n_elements, op, result);
+    break;
+  }
+  return true;
+}
+
+ExecutionStatus ExecuteArrayComparison(const Instruction& instruction, UserInterface& ui,
+                                       Workspace& ws, const sup::dto::AnyValue& lhs,
+                                       const sup::dto::AnyValue& rhs, ComparisonOperator op,
+                                       ArrayComparisonMode mode)
+{
+  std::vector<sup::dto::uint8> element_results;
+  std::string error;
+  if (!CompareElementwise(lhs, rhs, op, element_results, error))
+  {
+    std::string warning_message = InstructionWarningProlog(instruction) +
+      "could not compare element-wise: " + error;
+    LogWarning(ui, warning_message);
+    return ExecutionStatus::FAILURE;
+  }
+  const std::size_t n_true = std::accumulate(element_results.begin(), element_results.end(),
+                                             std::size_t{0});
+  switch (mode)
+  {
+  case ArrayComparisonMode::kAll:
+    return n_true == element_results.size() ? ExecutionStatus::SUCCESS
+                                            : ExecutionStatus::FAILURE;
+  case ArrayComparisonMode::kAny:
+    return n_true > 0 ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
+  case ArrayComparisonMode::kCount:
+  {
+    sup::dto::AnyValue count{sup::dto::UnsignedInteger64Type,
+                             static_cast<sup::dto::uint64>(n_true)};
+    return SetValueFromAttributeName(instruction, ws, ui,
+                                     Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME, count)
+             ? ExecutionStatus::SUCCESS
+             : ExecutionStatus::FAILURE;
+  }
+  case ArrayComparisonMode::kElementwise:
+  {
+    sup::dto::AnyValue output{element_results.size(), sup::dto::BooleanType};
+    for (std::size_t idx = 0; idx < element_results.size(); ++idx)
+    {
+      output[idx] = static_cast<sup::dto::boolean>(element_results[idx] != 0);
+    }
+    return SetValueFromAttributeName(instruction, ws, ui,
+                                     Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME, output)
+             ? ExecutionStatus::SUCCESS
+             : ExecutionStatus::FAILURE;
+  }
+  default:
+    break;
+  }
+  return ExecutionStatus::FAILURE;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+namespace
+{
+using sup::oac_tree::ComparisonOperator;
+
+bool GetElementTypeCode(const sup::dto::AnyValue& value, sup::dto::TypeCode& type_code)
+{
+  if (sup::dto::IsArrayValue(value))
+  {
+    type_code = value.GetType().ElementType().GetTypeCode();
+  }
+  else
+  {
+    type_code = value.GetTypeCode();
+  }
+  return type_code >= sup::dto::TypeCode::Bool && type_code <= sup::dto::TypeCode::Float64;
+}
+
+bool IsUnsignedTypeCode(sup::dto::TypeCode type_code)
+{
+  switch (type_code)
+  {
+  case sup::dto::TypeCode::Bool:
+  case sup::dto::TypeCode::UInt8:
+  case sup::dto::TypeCode::UInt16:
+  case sup::dto::TypeCode::UInt32:
+  case sup::dto::TypeCode::UInt64:
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+bool IsFloatTypeCode(sup::dto::TypeCode type_code)
+{
+  return type_code == sup::dto::TypeCode::Float32 || type_code == sup::dto::TypeCode::Float64;
+}
+
+BufferType CommonBufferType(sup::dto::TypeCode left, sup::dto::TypeCode right)
+{
+  if (IsFloatTypeCode(left) || IsFloatTypeCode(right))
+  {
+    return BufferType::kFloat;
+  }
+  if (IsUnsignedTypeCode(left) && IsUnsignedTypeCode(right))
+  {
+    return BufferType::kUnsigned;
+  }
+  // Values of uint64 may not fit in a signed integer when the other operand is signed.
+  if (left == sup::dto::TypeCode::UInt64 || right == sup::dto::TypeCode::UInt64)
+  {
+    return BufferType::kFloat;
+  }
+  return BufferType::kSigned;
+}
+
+template <typename T>
+void FillBuffer(const sup::dto::AnyValue& value, std::size_t n_elements, std::vector<T>& buffer)
+{
+  buffer.resize(n_elements);
+  if (!sup::dto::IsArrayValue(value))
+  {
+    // Broadcast scalars, so the comparison kernels only need to handle contiguous buffers.
+    std::fill(buffer.begin(), buffer.end(), value.As<T>());
+    return;
+  }
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    buffer[idx] = value[idx].As<T>();
+  }
+}
+
+template <typename T, typename Op>
+void CompareKernel(const T* lhs, const T* rhs, std::size_t n_elements, sup::dto::uint8* result,
+                   Op op)
+{
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    result[idx] = static_cast<sup::dto::uint8>(op(lhs[idx], rhs[idx]));
+  }
+}
+
+template <typename T>
+void CompareBuffers(const sup::dto::AnyValue& lhs, const sup::dto::AnyValue& rhs,
+                    std::size_t n_elements, ComparisonOperator op,
+                    std::vector<sup::dto::uint8>& result)
+{
+  std::vector<T> left;
+  std::vector<T> right;
+  FillBuffer(lhs, n_elements, left);
+  FillBuffer(rhs, n_elements, right);
+  result.resize(n_elements);
+  switch (op)
+  {
+  case ComparisonOperator::kEqual:
+    CompareKernel(left.data(), right.data(), n_elements, result.data(), std::equal_to<T>{});
+    break;
+  case ComparisonOperator::kGreaterThan:
+    CompareKernel(left.data(), right.data(), n_elements, result.data(), std::greater<T>{});
+    break;
+  case ComparisonOperator::kGreaterThanOrEqual:
+    CompareKernel(left.data(), right.data(), n_elements, result.data(), std::greater_equal<T>{});
+    break;
+  case ComparisonOperator::kLessThan:
+    CompareKernel(left.data(), right.data(), n_elements, result.data(), std::less<T>{});
+    break;
+  case ComparisonOperator::kLessThanOrEqual:
+    CompareKernel(left.data(), right.data(), n_elements, result.data(), std::less_equal<T>{});
+    break;
+  default:
+    break;
+  }
+}
+
+}  // unnamed namespace
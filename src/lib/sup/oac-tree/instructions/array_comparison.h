@@ -0,0 +1,126 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_ARRAY_COMPARISON_H_
+#define SUP_OAC_TREE_ARRAY_COMPARISON_H_
+
+#include <sup/oac-tree/execution_status.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/basic_scalar_types.h>
+
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+class UserInterface;
+class Workspace;
+
+/**
+ * @brief Comparison performed by a comparison instruction.
+ */
+enum class ComparisonOperator
+{
+  kEqual,
+  kGreaterThan,
+  kGreaterThanOrEqual,
+  kLessThan,
+  kLessThanOrEqual
+};
+
+/**
+ * @brief Array mode of a comparison instruction, as set by its 'arrayMode' attribute.
+ *
+ * @details kNone compares the whole values, which is the behaviour without 'arrayMode'. The other
+ * modes compare numeric arrays element by element (a scalar operand is compared to each element)
+ * and then:
+ *   - kAll: succeed if the comparison holds for all elements;
+ *   - kAny: succeed if the comparison holds for at least one element;
+ *   - kCount: write the number of elements for which the comparison holds to 'outputVar';
+ *   - kElementwise: write the boolean array of element-wise results to 'outputVar'.
+ */
+enum class ArrayComparisonMode
+{
+  kNone,
+  kAll,
+  kAny,
+  kCount,
+  kElementwise
+};
+
+/**
+ * @brief Parse the 'arrayMode' attribute of a comparison instruction.
+ *
+ * @param instruction Comparison instruction.
+ *
+ * @return Parsed array mode or kNone when the attribute is not present.
+ *
+ * @throw InstructionSetupException when the mode is unknown or when the presence of the
+ * 'outputVar' attribute does not match the mode.
+ */
+ArrayComparisonMode ParseArrayComparisonMode(const Instruction& instruction);
+
+/**
+ * @brief Compare two numeric arrays, or a numeric array and a scalar, element by element.
+ *
+ * @details The elements are first copied into contiguous buffers of a common type (int64, uint64
+ * or float64), after which the comparison is a simple loop that the compiler can vectorise.
+ *
+ * @param lhs Left hand side array or scalar.
+ * @param rhs Right hand side array or scalar.
+ * @param op Comparison operator.
+ * @param result Element-wise results (0 or 1).
+ * @param error Description of the problem when the comparison failed.
+ *
+ * @return true on success.
+ */
+bool CompareElementwise(const sup::dto::AnyValue& lhs, const sup::dto::AnyValue& rhs,
+                        ComparisonOperator op, std::vector<sup::dto::uint8>& result,
+                        std::string& error);
+
+/**
+ * @brief Execute the array mode of a comparison instruction.
+ *
+ * @param instruction Comparison instruction.
+ * @param ui UserInterface to use for logging warnings.
+ * @param ws Workspace to write the output variable to.
+ * @param lhs Left hand side array or scalar.
+ * @param rhs Right hand side array or scalar.
+ * @param op Comparison operator.
+ * @param mode Array mode, different from kNone.
+ *
+ * @return Execution status of the instruction.
+ */
+ExecutionStatus ExecuteArrayComparison(const Instruction& instruction, UserInterface& ui,
+                                       Workspace& ws, const sup::dto::AnyValue& lhs,
+                                       const sup::dto::AnyValue& rhs, ComparisonOperator op,
+                                       ArrayComparisonMode mode);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_ARRAY_COMPARISON_H_
@@ -71,6 +71,12 @@ void Async::ResetHook(UserInterface& ui)
   ResetChild(ui);
 }
 
+bool Async::IsNonBlockingImpl() const
+{
+  // The child instruction is always executed in a separate thread.
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -53,6 +53,8 @@ private:
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
 
   void ResetHook(UserInterface& ui) override;
+
+  bool IsNonBlockingImpl() const override;
 };
 
 }  // namespace oac_tree
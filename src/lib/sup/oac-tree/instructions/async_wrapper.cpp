@@ -22,6 +22,8 @@
 
 #include "async_wrapper.h"
 
+#include <sup/oac-tree/scope_guard.h>
+
 #include <chrono>
 #include <functional>
 
@@ -29,8 +31,12 @@ namespace sup
 {
 namespace oac_tree
 {
-AsyncWrapper::AsyncWrapper(Instruction* instruction)
+AsyncWrapper::AsyncWrapper(Instruction* instruction, std::function<void()> on_finished,
+                           std::shared_ptr<ExecutionTimes> times)
   : m_instruction{instruction}
+  , m_on_finished{std::move(on_finished)}
+  , m_inline{false}
+  , m_times{times ? std::move(times) : std::make_shared<ExecutionTimes>()}
   , m_status{ExecutionStatus::NOT_STARTED}
   , m_child_result{}
 {}
@@ -39,7 +45,7 @@ AsyncWrapper::AsyncWrapper(AsyncWrapper&&) = default;
 
 AsyncWrapper::~AsyncWrapper() = default;
 
-void AsyncWrapper::Tick(UserInterface& ui, Workspace& ws)
+bool AsyncWrapper::Tick(UserInterface& ui, Workspace& ws)
 {
   // Only query instruction status and possibly launch child instruction when there's no
   // unfinished thread.
@@ -48,10 +54,38 @@ void AsyncWrapper::Tick(UserInterface& ui, Workspace& ws)
     auto status_changed = UpdateStatus();
     if (!status_changed && NeedsExecute(m_status))
     {
+      if (m_inline)
+      {
+        ExecuteTimed(m_instruction, ui, ws, *m_times);
+        m_status = m_instruction->GetStatus();
+        return false;
+      }
       LaunchChild(ui, ws);
       m_status = ExecutionStatus::RUNNING;
+      return true;
     }
   }
+  return false;
+}
+
+void AsyncWrapper::SetInline(bool is_inline)
+{
+  m_inline = is_inline;
+}
+
+bool AsyncWrapper::IsInline() const
+{
+  return m_inline;
+}
+
+sup::dto::uint64 AsyncWrapper::GetExecutionCount() const
+{
+  return m_times->m_count;
+}
+
+sup::dto::int64 AsyncWrapper::GetMaxExecutionTimeNs() const
+{
+  return m_times->m_max_ns;
 }
 
 ExecutionStatus AsyncWrapper::GetStatus() const
@@ -86,8 +120,31 @@ bool AsyncWrapper::UpdateStatus()
 
 void AsyncWrapper::LaunchChild(UserInterface& ui, Workspace& ws)
 {
-  m_child_result = std::async(std::launch::async, &Instruction::ExecuteSingle,
-                              m_instruction, std::ref(ui), std::ref(ws));
+  auto instruction = m_instruction;
+  auto on_finished = m_on_finished;
+  auto times = m_times;
+  auto execute = [instruction, on_finished, times, &ui, &ws]()
+  {
+    // Always report that the thread finished, also when an exception is propagated:
+    ScopeGuard finished_guard{on_finished};
+    ExecuteTimed(instruction, ui, ws, *times);
+  };
+  m_child_result = std::async(std::launch::async, execute);
+}
+
+void AsyncWrapper::ExecuteTimed(Instruction* instruction, UserInterface& ui, Workspace& ws,
+                                ExecutionTimes& times)
+{
+  auto start = std::chrono::steady_clock::now();
+  instruction->ExecuteSingle(ui, ws);
+  auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - start).count();
+  ++times.m_count;
+  // Only the thread executing the instruction updates the maximum, so no CAS loop is needed.
+  if (duration_ns > times.m_max_ns)
+  {
+    times.m_max_ns = duration_ns;
+  }
 }
 
 }  // namespace oac_tree
@@ -25,6 +25,8 @@
 
 #include <sup/oac-tree/instruction.h>
 
+#include <atomic>
+#include <functional>
 #include <future>
 #include <memory>
 
@@ -45,15 +47,32 @@ namespace oac_tree
  *   instruction.
  * - RUNNING: there is a thread that has possibly finished execution. We cannot safely call methods
  *   on the wrapped instruction if these are not threadsafe.
+ *
+ * The wrapper can also execute the instruction inline, i.e. on the thread that calls Tick, which
+ * avoids the thread handoff for instructions that finish quickly.
  */
 class AsyncWrapper
 {
 public:
+  /**
+   * @brief Statistics of the execution steps, shared with the execution threads.
+   */
+  struct ExecutionTimes
+  {
+    std::atomic<sup::dto::uint64> m_count{0};
+    std::atomic<sup::dto::int64> m_max_ns{0};
+  };
+
   /**
    * @brief Constructor.
    * @param instruction The wrapped Instruction.
+   * @param on_finished Optional function that is called from the execution thread, each time the
+   * wrapped instruction finishes its ExecuteSingle call.
+   * @param times Optional statistics to update, e.g. to keep them across wrappers of the same
+   * instruction. When empty, the wrapper starts with its own statistics.
    */
-  AsyncWrapper(Instruction* instruction);
+  AsyncWrapper(Instruction* instruction, std::function<void()> on_finished = {},
+               std::shared_ptr<ExecutionTimes> times = {});
 
   /**
    * @brief Move constructor.
@@ -69,8 +88,36 @@ public:
    *
    * @details Launches the ExecuteSingle method on the wrapped instruction
    * asynchronously if it is not already running.
+   *
+   * @return true if a new execution thread was launched.
+   */
+  bool Tick(UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Select inline execution of the wrapped instruction.
+   *
+   * @param is_inline If true, next ticks will execute the instruction on the calling thread.
+   *
+   * @note A thread that is still running is not affected.
+   */
+  void SetInline(bool is_inline);
+
+  /**
+   * @brief Query if the wrapped instruction is executed inline.
+   */
+  bool IsInline() const;
+
+  /**
+   * @brief Get the number of execution steps of the wrapped instruction so far.
    */
-  void Tick(UserInterface& ui, Workspace& ws);
+  sup::dto::uint64 GetExecutionCount() const;
+
+  /**
+   * @brief Get the longest duration of a single execution step of the wrapped instruction so far.
+   *
+   * @return Duration in nanoseconds.
+   */
+  sup::dto::int64 GetMaxExecutionTimeNs() const;
 
   /**
    * @brief Get execution status
@@ -88,6 +135,21 @@ private:
    */
   Instruction* m_instruction;
 
+  /**
+   * @brief Function to call when an execution thread finishes.
+   */
+  std::function<void()> m_on_finished;
+
+  /**
+   * @brief Execute the wrapped instruction on the calling thread.
+   */
+  bool m_inline;
+
+  /**
+   * @brief Statistics of the execution steps, shared with the execution threads.
+   */
+  std::shared_ptr<ExecutionTimes> m_times;
+
   /**
    * @brief Execution status of the wrapper
    */
@@ -115,6 +177,12 @@ private:
    * @brief Execution status of the wrapper
    */
   void LaunchChild(UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Execute a single step of an instruction and record its duration.
+   */
+  static void ExecuteTimed(Instruction* instruction, UserInterface& ui, Workspace& ws,
+                           ExecutionTimes& times);
 };
 
 }  // namespace oac_tree
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "atomic_sequence.h"
+
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string AtomicSequence::Type = "AtomicSequence";
+
+AtomicSequence::AtomicSequence()
+  : CompoundInstruction(AtomicSequence::Type)
+{}
+
+AtomicSequence::~AtomicSequence() = default;
+
+void AtomicSequence::SetupImpl(const Procedure& proc)
+{
+  SetupChildren(proc);
+  // All children are executed to completion within a single tick on the calling thread, so
+  // children that wait for anything would stall the runner with the transaction open:
+  for (auto instruction : Children())
+  {
+    if (!instruction->CompletesSynchronously())
+    {
+      std::string error_message = InstructionSetupExceptionProlog(*this) +
+        "child instruction of type [" + instruction->GetType() +
+        "] does not complete synchronously";
+      throw InstructionSetupException(error_message);
+    }
+  }
+}
+
+ExecutionStatus AtomicSequence::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  // When already inside a transaction (e.g. nested AtomicSequence), the outer one commits.
+  const bool owns_transaction = ws.BeginTransaction();
+  ExecutionStatus status{ExecutionStatus::FAILURE};
+  try
+  {
+    status = ExecuteChildren(ui, ws);
+  }
+  catch (...)
+  {
+    if (owns_transaction)
+    {
+      ws.AbortTransaction();
+    }
+    throw;
+  }
+  if (!owns_transaction)
+  {
+    return status;
+  }
+  if (status != ExecutionStatus::SUCCESS)
+  {
+    ws.AbortTransaction();
+    return status;
+  }
+  if (!ws.CommitTransaction())
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "could not commit the workspace writes of the child instructions";
+    LogWarning(ui, warning_message);
+    return ExecutionStatus::FAILURE;
+  }
+  return ExecutionStatus::SUCCESS;
+}
+
+ExecutionStatus AtomicSequence::ExecuteChildren(UserInterface& ui, Workspace& ws)
+{
+  for (auto instruction : Children())
+  {
+    while (NeedsExecute(instruction->GetStatus()))
+    {
+      if (IsHaltRequested())
+      {
+        return ExecutionStatus::FAILURE;
+      }
+      instruction->ExecuteSingle(ui, ws);
+    }
+    if (instruction->GetStatus() != ExecutionStatus::SUCCESS)
+    {
+      return ExecutionStatus::FAILURE;
+    }
+  }
+  return IsHaltRequested() ? ExecutionStatus::FAILURE : ExecutionStatus::SUCCESS;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_ATOMIC_SEQUENCE_H_
+#define SUP_OAC_TREE_ATOMIC_SEQUENCE_H_
+
+#include <sup/oac-tree/compound_instruction.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Compound instruction representing a sequence whose workspace writes are applied
+ * atomically.
+ *
+ * @details AtomicSequence executes all its children in a single tick, like a Sequence, while the
+ * workspace writes of the children are staged in a workspace transaction. When all children
+ * succeed, the transaction is committed: all written variables are updated at once and observers
+ * never see a partial result. When a child fails or the instruction is halted, the staged writes
+ * are discarded.
+ *
+ * @note Children are ticked until they finish, without delay in between. Since this happens in a
+ * single tick of the runner thread, only children that complete synchronously are accepted during
+ * setup (see Instruction::CompletesSynchronously): instructions that wait for time to pass, for user
+ * input or for instructions on other threads are rejected. When nested in another AtomicSequence,
+ * the writes are staged in the outer transaction.
+ */
+class AtomicSequence : public CompoundInstruction
+{
+public:
+  AtomicSequence();
+
+  ~AtomicSequence() override;
+
+  static const std::string Type;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  /**
+   * @brief Execute all child instructions until one of them does not succeed.
+   */
+  ExecutionStatus ExecuteChildren(UserInterface& ui, Workspace& ws);
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_ATOMIC_SEQUENCE_H_
@@ -124,7 +124,7 @@ bool Choice::CreateInstructionList(UserInterface& ui, Workspace& ws)
     return false;
   }
   std::vector<Instruction*> instr_list;
-  auto child_instructions = ChildInstructions();
+  auto child_instructions = Children();
   for (auto idx : indices)
   {
     if (idx >= child_instructions.size())
@@ -0,0 +1,771 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "compiled_expression.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anytype.h>
+
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+bool IsIdentifierStart(char c);
+bool IsIdentifierChar(char c);
+bool ToExpressionValue(const sup::dto::AnyValue& anyvalue, sup::oac_tree::ExpressionValue& value);
+sup::dto::float64 AsFloat(const sup::oac_tree::ExpressionValue& value);
+bool IsFloat(const sup::oac_tree::ExpressionValue& value);
+}  // unnamed namespace
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Recursive descent parser that appends the nodes of the expression tree in postfix order,
+ * so the root node is always the last one.
+ */
+class CompiledExpression::Parser
+{
+public:
+  Parser(const std::string& expression, std::vector<Node>& nodes,
+         std::vector<std::string>& variable_names);
+
+  void Parse();
+
+private:
+  struct OperatorToken
+  {
+    const char* symbol;
+    OpCode op;
+  };
+  using OperatorLevel = std::vector<OperatorToken>;
+
+  static const std::vector<OperatorLevel>& BinaryOperatorLevels();
+
+  std::size_t ParseBinary(std::size_t level);
+  std::size_t ParseUnary();
+  std::size_t ParsePrimary();
+  std::size_t ParseNumber();
+  std::size_t ParseVariable(const std::string& identifier);
+  std::string ParseIdentifier();
+
+  std::size_t AddConstant(const ExpressionValue& value);
+  std::size_t AddUnary(OpCode op, std::size_t operand);
+  std::size_t AddBinary(OpCode op, std::size_t lhs, std::size_t rhs);
+
+  void SkipWhitespace();
+  bool MatchSymbol(const char* symbol);
+  bool MatchOperator(const OperatorLevel& level, OpCode& op);
+  [[noreturn]] void ThrowError(const std::string& message) const;
+
+  const std::string& m_expression;
+  std::size_t m_pos;
+  std::vector<Node>& m_nodes;
+  std::vector<std::string>& m_variable_names;
+};
+
+ExpressionValue ExpressionValue::Boolean(bool val)
+{
+  return { Kind::kBoolean, val ? 1 : 0, 0.0 };
+}
+
+ExpressionValue ExpressionValue::Integer(sup::dto::int64 val)
+{
+  return { Kind::kInteger, val, 0.0 };
+}
+
+ExpressionValue ExpressionValue::Float(sup::dto::float64 val)
+{
+  return { Kind::kFloat, 0, val };
+}
+
+bool IsTrue(const ExpressionValue& value)
+{
+  return IsFloat(value) ? value.floating != 0.0 : value.integer != 0;
+}
+
+sup::dto::AnyValue ToAnyValue(const ExpressionValue& value)
+{
+  switch (value.kind)
+  {
+  case ExpressionValue::Kind::kBoolean:
+    return sup::dto::AnyValue{ sup::dto::BooleanType, value.integer != 0 };
+  case ExpressionValue::Kind::kInteger:
+    return sup::dto::AnyValue{ sup::dto::SignedInteger64Type, value.integer };
+  default:
+    break;
+  }
+  return sup::dto::AnyValue{ sup::dto::Float64Type, value.floating };
+}
+
+CompiledExpression::CompiledExpression()
+  : m_nodes{}
+  , m_variable_names{}
+  , m_variable_paths{}
+{}
+
+CompiledExpression::CompiledExpression(const std::string& expression)
+  : m_nodes{}
+  , m_variable_names{}
+  , m_variable_paths{}
+{
+  Parser parser{expression, m_nodes, m_variable_names};
+  parser.Parse();
+  for (const auto& var_name : m_variable_names)
+  {
+    m_variable_paths.push_back(SplitFieldName(var_name));
+  }
+}
+
+CompiledExpression::~CompiledExpression() = default;
+
+CompiledExpression::CompiledExpression(const CompiledExpression& other) = default;
+CompiledExpression::CompiledExpression(CompiledExpression&& other) = default;
+
+CompiledExpression& CompiledExpression::operator=(const CompiledExpression& other) = default;
+CompiledExpression& CompiledExpression::operator=(CompiledExpression&& other) = default;
+
+bool CompiledExpression::IsEmpty() const
+{
+  return m_nodes.empty();
+}
+
+const std::vector<std::string>& CompiledExpression::VariableNames() const
+{
+  return m_variable_names;
+}
+
+bool CompiledExpression::Evaluate(const Workspace& ws, ExpressionValue& result,
+                                  std::string& error) const
+{
+  if (IsEmpty())
+  {
+    error = "empty expression";
+    return false;
+  }
+  return EvaluateNode(m_nodes.size() - 1, ws, result, error);
+}
+
+bool CompiledExpression::EvaluateNode(std::size_t idx, const Workspace& ws,
+                                      ExpressionValue& result, std::string& error) const
+{
+  const auto& node = m_nodes[idx];
+  switch (node.op)
+  {
+  case OpCode::kConstant:
+    result = node.value;
+    return true;
+  case OpCode::kVariable:
+  {
+    const auto& var_name = m_variable_names[node.lhs];
+    const auto& [root_name, field_name] = m_variable_paths[node.lhs];
+    // A snapshot avoids copying the whole variable when only a field is referenced.
+    auto snapshot = ws.GetSnapshot(root_name);
+    if (!snapshot || sup::dto::IsEmptyValue(*snapshot)
+        || (!field_name.empty() && !snapshot->HasField(field_name)))
+    {
+      error = "could not read variable [" + var_name + "] from workspace";
+      return false;
+    }
+    const auto& anyvalue = field_name.empty() ? *snapshot : (*snapshot)[field_name];
+    if (!ToExpressionValue(anyvalue, result))
+    {
+      error = "variable [" + var_name + "] is not a boolean or numeric scalar";
+      return false;
+    }
+    return true;
+  }
+  case OpCode::kNot:
+  case OpCode::kNegate:
+  {
+    ExpressionValue operand;
+    return EvaluateNode(node.lhs, ws, operand, error) &&
+           ApplyUnary(node.op, operand, result, error);
+  }
+  case OpCode::kAnd:
+  case OpCode::kOr:
+  {
+    // Short-circuit: the right hand side is only evaluated when it determines the result.
+    ExpressionValue lhs;
+    if (!EvaluateNode(node.lhs, ws, lhs, error))
+    {
+      return false;
+    }
+    const bool is_or = node.op == OpCode::kOr;
+    if (IsTrue(lhs) == is_or)
+    {
+      result = ExpressionValue::Boolean(is_or);
+      return true;
+    }
+    ExpressionValue rhs;
+    if (!EvaluateNode(node.rhs, ws, rhs, error))
+    {
+      return false;
+    }
+    result = ExpressionValue::Boolean(IsTrue(rhs));
+    return true;
+  }
+  default:
+    break;
+  }
+  ExpressionValue lhs;
+  ExpressionValue rhs;
+  return EvaluateNode(node.lhs, ws, lhs, error) && EvaluateNode(node.rhs, ws, rhs, error) &&
+         ApplyBinary(node.op, lhs, rhs, result, error);
+}
+
+bool CompiledExpression::ApplyUnary(OpCode op, const ExpressionValue& operand,
+                                    ExpressionValue& result, std::string& error)
+{
+  switch (op)
+  {
+  case OpCode::kNot:
+    result = ExpressionValue::Boolean(!IsTrue(operand));
+    return true;
+  case OpCode::kNegate:
+    if (IsFloat(operand))
+    {
+      result = ExpressionValue::Float(-operand.floating);
+      return true;
+    }
+    if (operand.integer == std::numeric_limits<sup::dto::int64>::min())
+    {
+      error = "integer overflow in negation";
+      return false;
+    }
+    result = ExpressionValue::Integer(-operand.integer);
+    return true;
+  default:
+    break;
+  }
+  error = "unknown unary operator";
+  return false;
+}
+
+bool CompiledExpression::ApplyBinary(OpCode op, const ExpressionValue& lhs,
+                                     const ExpressionValue& rhs, ExpressionValue& result,
+                                     std::string& error)
+{
+  if (IsFloat(lhs) || IsFloat(rhs))
+  {
+    auto left = AsFloat(lhs);
+    auto right = AsFloat(rhs);
+    switch (op)
+    {
+    case OpCode::kMultiply:
+      result = ExpressionValue::Float(left * right);
+      return true;
+    case OpCode::kDivide:
+      result = ExpressionValue::Float(left / right);
+      return true;
+    case OpCode::kModulo:
+      result = ExpressionValue::Float(std::fmod(left, right));
+      return true;
+    case OpCode::kAdd:
+      result = ExpressionValue::Float(left + right);
+      return true;
+    case OpCode::kSubtract:
+      result = ExpressionValue::Float(left - right);
+      return true;
+    case OpCode::kLess:
+      result = ExpressionValue::Boolean(left < right);
+      return true;
+    case OpCode::kLessOrEqual:
+      result = ExpressionValue::Boolean(left <= right);
+      return true;
+    case OpCode::kGreater:
+      result = ExpressionValue::Boolean(left > right);
+      return true;
+    case OpCode::kGreaterOrEqual:
+      result = ExpressionValue::Boolean(left >= right);
+      return true;
+    case OpCode::kEqual:
+      result = ExpressionValue::Boolean(left == right);
+      return true;
+    case OpCode::kNotEqual:
+      result = ExpressionValue::Boolean(left != right);
+      return true;
+    default:
+      break;
+    }
+    error = "unknown binary operator";
+    return false;
+  }
+  // Wrap around on overflow for addition, subtraction and multiplication, as unsigned
+  // arithmetic does, instead of invoking undefined behaviour.
+  auto left = lhs.integer;
+  auto right = rhs.integer;
+  auto u_left = static_cast<sup::dto::uint64>(left);
+  auto u_right = static_cast<sup::dto::uint64>(right);
+  switch (op)
+  {
+  case OpCode::kMultiply:
+    result = ExpressionValue::Integer(static_cast<sup::dto::int64>(u_left * u_right));
+    return true;
+  case OpCode::kDivide:
+  case OpCode::kModulo:
+    if (right == 0)
+    {
+      error = "integer division by zero";
+      return false;
+    }
+    if (left == std::numeric_limits<sup::dto::int64>::min() && right == -1)
+    {
+      error = "integer overflow in division";
+      return false;
+    }
+    result = ExpressionValue::Integer(op == OpCode::kDivide ? left / right : left % right);
+    return true;
+  case OpCode::kAdd:
+    result = ExpressionValue::Integer(static_cast<sup::dto::int64>(u_left + u_right));
+    return true;
+  case OpCode::kSubtract:
+    result = ExpressionValue::Integer(static_cast<sup::dto::int64>(u_left - u_right));
+    return true;
+  case OpCode::kLess:
+    result = ExpressionValue::Boolean(left < right);
+    return true;
+  case OpCode::kLessOrEqual:
+    result = ExpressionValue::Boolean(left <= right);
+    return true;
+  case OpCode::kGreater:
+    result = ExpressionValue::Boolean(left > right);
+    return true;
+  case OpCode::kGreaterOrEqual:
+    result = ExpressionValue::Boolean(left >= right);
+    return true;
+  case OpCode::kEqual:
+    result = ExpressionValue::Boolean(left == right);
+    return true;
+  case OpCode::kNotEqual:
+    result = ExpressionValue::Boolean(left != right);
+    return true;
+  default:
+    break;
+  }
+  error = "unknown binary operator";
+  return false;
+}
+
+CompiledExpression::Parser::Parser(const std::string& expression, std::vector<Node>& nodes,
+                                   std::vector<std::string>& variable_names)
+  : m_expression{expression}
+  , m_pos{0}
+  , m_nodes{nodes}
+  , m_variable_names{variable_names}
+{}
+
+void CompiledExpression::Parser::Parse()
+{
+  SkipWhitespace();
+  if (m_pos == m_expression.size())
+  {
+    ThrowError("empty expression");
+  }
+  (void)ParseBinary(0);
+  SkipWhitespace();
+  if (m_pos != m_expression.size())
+  {
+    ThrowError("unexpected character '" + m_expression.substr(m_pos, 1) + "'");
+  }
+}
+
+const std::vector<CompiledExpression::Parser::OperatorLevel>&
+CompiledExpression::Parser::BinaryOperatorLevels()
+{
+  // Ordered from lowest to highest precedence. Longer symbols need to come first.
+  static const std::vector<OperatorLevel> levels = {
+    { { "||", OpCode::kOr }, { "or", OpCode::kOr } },
+    { { "&&", OpCode::kAnd }, { "and", OpCode::kAnd } },
+    { { "==", OpCode::kEqual }, { "!=", OpCode::kNotEqual } },
+    { { "<=", OpCode::kLessOrEqual }, { ">=", OpCode::kGreaterOrEqual },
+      { "<", OpCode::kLess }, { ">", OpCode::kGreater } },
+    { { "+", OpCode::kAdd }, { "-", OpCode::kSubtract } },
+    { { "*", OpCode::kMultiply }, { "/", OpCode::kDivide }, { "%", OpCode::kModulo } }
+  };
+  return levels;
+}
+
+std::size_t CompiledExpression::Parser::ParseBinary(std::size_t level)
+{
+  const auto& levels = BinaryOperatorLevels();
+  if (level == levels.size())
+  {
+    return ParseUnary();
+  }
+  auto lhs = ParseBinary(level + 1);
+  OpCode op{};
+  while (MatchOperator(levels[level], op))
+  {
+    auto rhs = ParseBinary(level + 1);
+    lhs = AddBinary(op, lhs, rhs);
+  }
+  return lhs;
+}
+
+std::size_t CompiledExpression::Parser::ParseUnary()
+{
+  SkipWhitespace();
+  if (m_pos + 1 < m_expression.size() && m_expression.compare(m_pos, 2, "!=") == 0)
+  {
+    ThrowError("unexpected operator '!='");
+  }
+  if (MatchSymbol("!") || MatchSymbol("not"))
+  {
+    return AddUnary(OpCode::kNot, ParseUnary());
+  }
+  if (MatchSymbol("-"))
+  {
+    return AddUnary(OpCode::kNegate, ParseUnary());
+  }
+  if (MatchSymbol("+"))
+  {
+    return ParseUnary();
+  }
+  return ParsePrimary();
+}
+
+std::size_t CompiledExpression::Parser::ParsePrimary()
+{
+  SkipWhitespace();
+  if (m_pos == m_expression.size())
+  {
+    ThrowError("unexpected end of expression");
+  }
+  if (MatchSymbol("("))
+  {
+    auto result = ParseBinary(0);
+    if (!MatchSymbol(")"))
+    {
+      ThrowError("missing closing parenthesis");
+    }
+    return result;
+  }
+  auto c = m_expression[m_pos];
+  if (std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+  {
+    return ParseNumber();
+  }
+  if (!IsIdentifierStart(c))
+  {
+    ThrowError("unexpected character '" + std::string(1, c) + "'");
+  }
+  auto identifier = ParseIdentifier();
+  if (identifier == "true" || identifier == "false")
+  {
+    return AddConstant(ExpressionValue::Boolean(identifier == "true"));
+  }
+  if (identifier == "and" || identifier == "or" || identifier == "not")
+  {
+    ThrowError("unexpected keyword '" + identifier + "'");
+  }
+  return ParseVariable(identifier);
+}
+
+std::size_t CompiledExpression::Parser::ParseNumber()
+{
+  auto start = m_pos;
+  bool is_float = false;
+  auto skip_digits = [this]()
+  {
+    auto begin = m_pos;
+    while (m_pos < m_expression.size() &&
+           std::isdigit(static_cast<unsigned char>(m_expression[m_pos])))
+    {
+      ++m_pos;
+    }
+    return m_pos > begin;
+  };
+  bool has_digits = skip_digits();
+  if (m_pos < m_expression.size() && m_expression[m_pos] == '.')
+  {
+    is_float = true;
+    ++m_pos;
+    has_digits = skip_digits() || has_digits;
+  }
+  if (!has_digits)
+  {
+    ThrowError("invalid numeric literal");
+  }
+  if (m_pos < m_expression.size() && (m_expression[m_pos] == 'e' || m_expression[m_pos] == 'E'))
+  {
+    is_float = true;
+    ++m_pos;
+    if (m_pos < m_expression.size() && (m_expression[m_pos] == '+' || m_expression[m_pos] == '-'))
+    {
+      ++m_pos;
+    }
+    if (!skip_digits())
+    {
+      ThrowError("invalid exponent in numeric literal");
+    }
+  }
+  if (m_pos < m_expression.size() && IsIdentifierChar(m_expression[m_pos]))
+  {
+    ThrowError("invalid numeric literal");
+  }
+  auto literal = m_expression.substr(start, m_pos - start);
+  errno = 0;
+  if (is_float)
+  {
+    auto value = std::strtod(literal.c_str(), nullptr);
+    if (errno == ERANGE && std::isinf(value))
+    {
+      ThrowError("numeric literal [" + literal + "] out of range");
+    }
+    return AddConstant(ExpressionValue::Float(value));
+  }
+  auto value = std::strtoll(literal.c_str(), nullptr, 10);
+  if (errno == ERANGE)
+  {
+    ThrowError("integer literal [" + literal + "] out of range");
+  }
+  return AddConstant(ExpressionValue::Integer(value));
+}
+
+std::size_t CompiledExpression::Parser::ParseVariable(const std::string& identifier)
+{
+  // Field and array element accessors directly follow the variable name without whitespace.
+  auto full_name = identifier;
+  while (m_pos < m_expression.size())
+  {
+    auto c = m_expression[m_pos];
+    if (c == '.')
+    {
+      ++m_pos;
+      if (m_pos == m_expression.size() || !IsIdentifierStart(m_expression[m_pos]))
+      {
+        ThrowError("invalid field name after '" + full_name + ".'");
+      }
+      full_name += "." + ParseIdentifier();
+    }
+    else if (c == '[')
+    {
+      auto close_pos = m_expression.find(']', m_pos);
+      if (close_pos == std::string::npos || close_pos == m_pos + 1 ||
+          m_expression.find_first_not_of("0123456789", m_pos + 1) != close_pos)
+      {
+        ThrowError("invalid array index after '" + full_name + "'");
+      }
+      full_name += m_expression.substr(m_pos, close_pos + 1 - m_pos);
+      m_pos = close_pos + 1;
+    }
+    else
+    {
+      break;
+    }
+  }
+  std::size_t var_idx = 0;
+  while (var_idx < m_variable_names.size() && m_variable_names[var_idx] != full_name)
+  {
+    ++var_idx;
+  }
+  if (var_idx == m_variable_names.size())
+  {
+    m_variable_names.push_back(full_name);
+  }
+  m_nodes.push_back({ OpCode::kVariable, var_idx, 0, ExpressionValue::Integer(0) });
+  return m_nodes.size() - 1;
+}
+
+std::string CompiledExpression::Parser::ParseIdentifier()
+{
+  auto start = m_pos;
+  while (m_pos < m_expression.size() && IsIdentifierChar(m_expression[m_pos]))
+  {
+    ++m_pos;
+  }
+  return m_expression.substr(start, m_pos - start);
+}
+
+std::size_t CompiledExpression::Parser::AddConstant(const ExpressionValue& value)
+{
+  m_nodes.push_back({ OpCode::kConstant, 0, 0, value });
+  return m_nodes.size() - 1;
+}
+
+std::size_t CompiledExpression::Parser::AddUnary(OpCode op, std::size_t operand)
+{
+  if (m_nodes[operand].op == OpCode::kConstant)
+  {
+    ExpressionValue folded;
+    std::string error;
+    if (!ApplyUnary(op, m_nodes[operand].value, folded, error))
+    {
+      ThrowError(error);
+    }
+    m_nodes.pop_back();
+    return AddConstant(folded);
+  }
+  m_nodes.push_back({ op, operand, 0, ExpressionValue::Integer(0) });
+  return m_nodes.size() - 1;
+}
+
+std::size_t CompiledExpression::Parser::AddBinary(OpCode op, std::size_t lhs, std::size_t rhs)
+{
+  // Constant operands are always single nodes at the end of the list.
+  if (m_nodes[lhs].op == OpCode::kConstant && m_nodes[rhs].op == OpCode::kConstant)
+  {
+    const auto& left = m_nodes[lhs].value;
+    const auto& right = m_nodes[rhs].value;
+    ExpressionValue folded;
+    std::string error;
+    if (op == OpCode::kAnd || op == OpCode::kOr)
+    {
+      folded = ExpressionValue::Boolean(op == OpCode::kAnd ? IsTrue(left) && IsTrue(right)
+                                                           : IsTrue(left) || IsTrue(right));
+    }
+    else if (!ApplyBinary(op, left, right, folded, error))
+    {
+      ThrowError(error);
+    }
+    m_nodes.resize(lhs);
+    return AddConstant(folded);
+  }
+  m_nodes.push_back({ op, lhs, rhs, ExpressionValue::Integer(0) });
+  return m_nodes.size() - 1;
+}
+
+void CompiledExpression::Parser::SkipWhitespace()
+{
+  while (m_pos < m_expression.size() &&
+         std::isspace(static_cast<unsigned char>(m_expression[m_pos])))
+  {
+    ++m_pos;
+  }
+}
+
+bool CompiledExpression::Parser::MatchSymbol(const char* symbol)
+{
+  SkipWhitespace();
+  auto length = std::strlen(symbol);
+  if (m_expression.compare(m_pos, length, symbol) != 0)
+  {
+    return false;
+  }
+  // Keywords need to be followed by a character that cannot continue an identifier.
+  auto end = m_pos + length;
+  if (IsIdentifierStart(symbol[0]) && end < m_expression.size() &&
+      IsIdentifierChar(m_expression[end]))
+  {
+    return false;
+  }
+  m_pos = end;
+  return true;
+}
+
+bool CompiledExpression::Parser::MatchOperator(const OperatorLevel& level, OpCode& op)
+{
+  for (const auto& token : level)
+  {
+    if (MatchSymbol(token.symbol))
+    {
+      op = token.op;
+      return true;
+    }
+  }
+  return false;
+}
+
+void CompiledExpression::Parser::ThrowError(const std::string& message) const
+{
+  std::string error_message = "CompiledExpression(): " + message + " at position " +
+    std::to_string(m_pos) + " in expression [" + m_expression + "]";
+  throw ParseException(error_message);
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+namespace
+{
+using sup::oac_tree::ExpressionValue;
+
+bool IsIdentifierStart(char c)
+{
+  return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool IsIdentifierChar(char c)
+{
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool ToExpressionValue(const sup::dto::AnyValue& anyvalue, ExpressionValue& value)
+{
+  switch (anyvalue.GetTypeCode())
+  {
+  case sup::dto::TypeCode::Bool:
+    value = ExpressionValue::Boolean(anyvalue.As<sup::dto::boolean>());
+    return true;
+  case sup::dto::TypeCode::Char8:
+  case sup::dto::TypeCode::Int8:
+  case sup::dto::TypeCode::UInt8:
+  case sup::dto::TypeCode::Int16:
+  case sup::dto::TypeCode::UInt16:
+  case sup::dto::TypeCode::Int32:
+  case sup::dto::TypeCode::UInt32:
+  case sup::dto::TypeCode::Int64:
+    value = ExpressionValue::Integer(anyvalue.As<sup::dto::int64>());
+    return true;
+  case sup::dto::TypeCode::UInt64:
+  {
+    auto u_value = anyvalue.As<sup::dto::uint64>();
+    if (u_value > static_cast<sup::dto::uint64>(std::numeric_limits<sup::dto::int64>::max()))
+    {
+      value = ExpressionValue::Float(static_cast<sup::dto::float64>(u_value));
+      return true;
+    }
+    value = ExpressionValue::Integer(static_cast<sup::dto::int64>(u_value));
+    return true;
+  }
+  case sup::dto::TypeCode::Float32:
+  case sup::dto::TypeCode::Float64:
+    value = ExpressionValue::Float(anyvalue.As<sup::dto::float64>());
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+sup::dto::float64 AsFloat(const ExpressionValue& value)
+{
+  return IsFloat(value) ? value.floating : static_cast<sup::dto::float64>(value.integer);
+}
+
+bool IsFloat(const ExpressionValue& value)
+{
+  return value.kind == ExpressionValue::Kind::kFloat;
+}
+
+}  // unnamed namespace
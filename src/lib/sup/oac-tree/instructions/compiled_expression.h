@@ -0,0 +1,191 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_COMPILED_EXPRESSION_H_
+#define SUP_OAC_TREE_COMPILED_EXPRESSION_H_
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/basic_scalar_types.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Workspace;
+
+/**
+ * @brief Scalar value produced by the evaluation of a CompiledExpression.
+ */
+struct ExpressionValue
+{
+  enum class Kind
+  {
+    kBoolean,
+    kInteger,
+    kFloat
+  };
+
+  static ExpressionValue Boolean(bool val);
+  static ExpressionValue Integer(sup::dto::int64 val);
+  static ExpressionValue Float(sup::dto::float64 val);
+
+  Kind kind;
+
+  // Holds the value of booleans (0 or 1) and integers.
+  sup::dto::int64 integer;
+
+  sup::dto::float64 floating;
+};
+
+/**
+ * @brief Truth value of an expression value: booleans as such and numbers when different from 0.
+ */
+bool IsTrue(const ExpressionValue& value);
+
+/**
+ * @brief Convert an expression value to an AnyValue of type boolean, int64 or float64.
+ */
+sup::dto::AnyValue ToAnyValue(const ExpressionValue& value);
+
+/**
+ * @brief Arithmetic and boolean expression that is parsed once into a flat tree of typed nodes.
+ *
+ * @details The expression language supports:
+ *   - numeric literals (e.g. '3', '-2.5e3') and the literals 'true' and 'false';
+ *   - workspace variable references, including fields and array elements (e.g. 'a.b[2]');
+ *   - parentheses;
+ *   - unary operators '!' (or 'not'), '-' and '+';
+ *   - binary operators '*', '/', '%', '+', '-', '<', '<=', '>', '>=', '==', '!=', '&&' (or 'and')
+ *     and '||' (or 'or'), with the precedence and associativity of C.
+ *
+ * Variable references are resolved to their full names during parsing and constant subexpressions
+ * are folded. Logical operators short-circuit, so variables in a skipped operand are not read.
+ * Arithmetic is performed on 64 bit integers, unless one of the operands is a floating point
+ * number. Unsigned values that do not fit in a signed 64 bit integer are treated as floating point.
+ */
+class CompiledExpression
+{
+public:
+  CompiledExpression();
+
+  /**
+   * @brief Parse the given expression.
+   *
+   * @param expression Expression string.
+   *
+   * @throw ParseException when the expression is not valid.
+   */
+  explicit CompiledExpression(const std::string& expression);
+
+  ~CompiledExpression();
+
+  CompiledExpression(const CompiledExpression& other);
+  CompiledExpression(CompiledExpression&& other);
+
+  CompiledExpression& operator=(const CompiledExpression& other);
+  CompiledExpression& operator=(CompiledExpression&& other);
+
+  /**
+   * @brief Check if this object contains a parsed expression.
+   */
+  bool IsEmpty() const;
+
+  /**
+   * @brief Get the (unique) full names of all referenced workspace variables or fields.
+   */
+  const std::vector<std::string>& VariableNames() const;
+
+  /**
+   * @brief Evaluate the expression, reading the referenced variables from the workspace.
+   *
+   * @param ws Workspace to read variables from.
+   * @param result Result of the evaluation.
+   * @param error Description of the problem when the evaluation failed.
+   *
+   * @return true on successful evaluation.
+   */
+  bool Evaluate(const Workspace& ws, ExpressionValue& result, std::string& error) const;
+
+private:
+  class Parser;
+
+  enum class OpCode : sup::dto::uint8
+  {
+    kConstant,
+    kVariable,
+    kNot,
+    kNegate,
+    kMultiply,
+    kDivide,
+    kModulo,
+    kAdd,
+    kSubtract,
+    kLess,
+    kLessOrEqual,
+    kGreater,
+    kGreaterOrEqual,
+    kEqual,
+    kNotEqual,
+    kAnd,
+    kOr
+  };
+
+  /**
+   * @brief Node of the expression tree. For variables, lhs is the index in the list of variable
+   * names. For operators, lhs and rhs are the indices of the operand nodes.
+   */
+  struct Node
+  {
+    OpCode op;
+    std::size_t lhs;
+    std::size_t rhs;
+    ExpressionValue value;
+  };
+
+  bool EvaluateNode(std::size_t idx, const Workspace& ws, ExpressionValue& result,
+                    std::string& error) const;
+
+  static bool ApplyUnary(OpCode op, const ExpressionValue& operand, ExpressionValue& result,
+                         std::string& error);
+
+  static bool ApplyBinary(OpCode op, const ExpressionValue& lhs, const ExpressionValue& rhs,
+                          ExpressionValue& result, std::string& error);
+
+  std::vector<Node> m_nodes;
+  std::vector<std::string> m_variable_names;
+
+  /**
+   * @brief Variable names split into the workspace variable name and the field name, so
+   * evaluation can extract fields from a variable snapshot.
+   */
+  std::vector<std::pair<std::string, std::string>> m_variable_paths;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_COMPILED_EXPRESSION_H_
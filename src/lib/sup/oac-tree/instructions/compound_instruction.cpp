@@ -24,6 +24,8 @@
 
 #include <sup/oac-tree/constants.h>
 
+#include <algorithm>
+
 namespace sup
 {
 namespace oac_tree
@@ -46,6 +48,7 @@ void CompoundInstruction::SetupChildren(const Procedure& proc)
   AssertChildrenPresent();
   for (auto& instruction : m_children)
   {
+    LinkCancellationToken(*instruction);
     instruction->Setup(proc);
   }
 }
@@ -55,6 +58,21 @@ bool CompoundInstruction::HasChildren() const
   return !m_children.empty();
 }
 
+std::size_t CompoundInstruction::NumberOfChildren() const
+{
+  return m_children.size();
+}
+
+Instruction* CompoundInstruction::ChildAt(std::size_t idx)
+{
+  return m_children[idx].get();
+}
+
+const Instruction* CompoundInstruction::ChildAt(std::size_t idx) const
+{
+  return m_children[idx].get();
+}
+
 void CompoundInstruction::ResetChildren(UserInterface& ui)
 {
   for (auto& instruction : m_children)
@@ -81,14 +99,24 @@ void CompoundInstruction::HaltImpl()
   HaltChildren();
 }
 
-std::vector<const Instruction*> CompoundInstruction::ChildInstructionsImpl() const
+ChildRange CompoundInstruction::ChildrenImpl() const
 {
-  std::vector<const Instruction*> result;
-  for (auto& instr : m_children)
-  {
-    result.push_back(instr.get());
-  }
-  return result;
+  return { m_children.data(), m_children.size() };
+}
+
+bool CompoundInstruction::IsNonBlockingImpl() const
+{
+  // A compound instruction only executes its children from its own execution step.
+  auto children = Children();
+  return std::all_of(children.begin(), children.end(),
+                     [](const Instruction* child) { return child->IsNonBlocking(); });
+}
+
+bool CompoundInstruction::CompletesSynchronouslyImpl() const
+{
+  auto children = Children();
+  return std::all_of(children.begin(), children.end(),
+                     [](const Instruction* child) { return child->CompletesSynchronously(); });
 }
 
 int CompoundInstruction::ChildrenCountImpl() const
@@ -54,6 +54,11 @@ ExecutionStatus Condition::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return result ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
 }
 
+bool Condition::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -46,6 +46,8 @@ public:
 
 private:
   virtual ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws);
+
+  virtual bool IsNonBlockingImpl() const;
 };
 
 }  // namespace oac_tree
@@ -56,6 +56,11 @@ ExecutionStatus Copy::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return ExecutionStatus::SUCCESS;
 }
 
+bool Copy::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "copy_many.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string CopyMany::Type = "CopyMany";
+
+CopyMany::CopyMany()
+  : Instruction(CopyMany::Type)
+  , m_copy_pairs{}
+{
+  AddAttributeDefinition(Constants::INPUT_VARIABLE_NAMES_ATTRIBUTE_NAME).SetMandatory();
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME).SetMandatory();
+  AddAttributeDefinition(Constants::TRANSACTIONAL_ATTRIBUTE_NAME, sup::dto::BooleanType)
+    .SetCategory(AttributeCategory::kBoth);
+}
+
+CopyMany::~CopyMany() = default;
+
+void CopyMany::SetupImpl(const Procedure&)
+{
+  auto input_names = instruction_utils::VariableNamesFromAttribute(
+    *this, Constants::INPUT_VARIABLE_NAMES_ATTRIBUTE_NAME);
+  auto output_names = instruction_utils::VariableNamesFromAttribute(
+    *this, Constants::OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME);
+  if (input_names.empty() || input_names.size() != output_names.size())
+  {
+    std::string error_message = InstructionSetupExceptionProlog(*this) +
+      "attributes [" + Constants::INPUT_VARIABLE_NAMES_ATTRIBUTE_NAME + "] and [" +
+      Constants::OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME +
+      "] need to contain the same, non-zero number of variable names";
+    throw InstructionSetupException(error_message);
+  }
+  m_copy_pairs.clear();
+  m_copy_pairs.reserve(input_names.size());
+  for (std::size_t idx = 0; idx < input_names.size(); ++idx)
+  {
+    m_copy_pairs.emplace_back(std::move(input_names[idx]), std::move(output_names[idx]));
+  }
+}
+
+ExecutionStatus CopyMany::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  sup::dto::boolean transactional = false;
+  if (!GetAttributeValueAs(Constants::TRANSACTIONAL_ATTRIBUTE_NAME, ws, ui, transactional))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  if (!transactional)
+  {
+    return CopyAll(ui, ws) ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
+  }
+  // When already inside a transaction (e.g. in an AtomicSequence), the outer one commits.
+  const bool owns_transaction = ws.BeginTransaction();
+  if (!CopyAll(ui, ws))
+  {
+    if (owns_transaction)
+    {
+      ws.AbortTransaction();
+    }
+    return ExecutionStatus::FAILURE;
+  }
+  if (owns_transaction && !ws.CommitTransaction())
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "could not commit the copied values to the workspace";
+    LogWarning(ui, warning_message);
+    return ExecutionStatus::FAILURE;
+  }
+  return ExecutionStatus::SUCCESS;
+}
+
+bool CopyMany::IsNonBlockingImpl() const
+{
+  return true;
+}
+
+bool CopyMany::CopyAll(UserInterface& ui, Workspace& ws) const
+{
+  for (const auto& [input_name, output_name] : m_copy_pairs)
+  {
+    sup::dto::AnyValue value;
+    if (!ws.GetValue(input_name, value))
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "could not read input variable with name [" + input_name + "] from workspace";
+      LogWarning(ui, warning_message);
+      return false;
+    }
+    if (!ws.SetValue(output_name, value))
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "could not write variable with name [" + output_name + "] to workspace";
+      LogWarning(ui, warning_message);
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
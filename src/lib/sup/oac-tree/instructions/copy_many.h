@@ -0,0 +1,71 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_COPY_MANY_H_
+#define SUP_OAC_TREE_COPY_MANY_H_
+
+#include <sup/oac-tree/instruction.h>
+
+#include <utility>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Instruction copying a list of variables from/to the workspace in a single step.
+ *
+ * @details The 'inputVars' and 'outputVars' attributes contain comma separated lists of equal
+ * length. They are parsed once during setup. The n-th input variable is copied to the n-th output
+ * variable and the instruction fails on the first copy that fails.
+ *
+ * When the optional 'transactional' attribute is true, the copies are staged in a workspace
+ * transaction, so they are either all applied or not at all, with a single notification per
+ * modified variable.
+ */
+class CopyMany : public Instruction
+{
+public:
+  CopyMany();
+
+  ~CopyMany() override;
+
+  static const std::string Type;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  bool CopyAll(UserInterface& ui, Workspace& ws) const;
+
+  std::vector<std::pair<std::string, std::string>> m_copy_pairs;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_COPY_MANY_H_
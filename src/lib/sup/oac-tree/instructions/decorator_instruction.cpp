@@ -50,6 +50,7 @@ Instruction* DecoratorInstruction::GetChild()
 void DecoratorInstruction::SetupChild(const Procedure &proc)
 {
   AssertChildPresent();
+  LinkCancellationToken(*m_child);
   m_child->Setup(proc);
 }
 
@@ -86,6 +87,16 @@ void DecoratorInstruction::HaltChild()
   }
 }
 
+bool DecoratorInstruction::IsChildNonBlocking() const
+{
+  return m_child && m_child->IsNonBlocking();
+}
+
+bool DecoratorInstruction::ChildCompletesSynchronously() const
+{
+  return m_child && m_child->CompletesSynchronously();
+}
+
 void DecoratorInstruction::ResetHook(UserInterface& ui)
 {
   ResetChild(ui);
@@ -96,14 +107,23 @@ void DecoratorInstruction::HaltImpl()
   HaltChild();
 }
 
-std::vector<const Instruction*> DecoratorInstruction::ChildInstructionsImpl() const
+ChildRange DecoratorInstruction::ChildrenImpl() const
 {
-  std::vector<const Instruction*> result;
-  if (m_child)
+  if (!m_child)
   {
-    result.push_back(m_child.get());
+    return {};
   }
-  return result;
+  return { std::addressof(m_child), 1u };
+}
+
+bool DecoratorInstruction::IsNonBlockingImpl() const
+{
+  return false;
+}
+
+bool DecoratorInstruction::CompletesSynchronouslyImpl() const
+{
+  return false;
 }
 
 std::vector<const Instruction*> DecoratorInstruction::NextInstructionsImpl() const
@@ -48,27 +48,32 @@ Decrement::~Decrement() = default;
 
 ExecutionStatus Decrement::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  sup::dto::AnyValue value;
-  if (!GetAttributeValue(Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, value))
+  bool decremented = true;
+  auto func = [&decremented](sup::dto::AnyValue& value)
   {
-    return ExecutionStatus::FAILURE;
-  }
-  if (!sup::dto::Decrement(value))
-  {
-    const std::string warning = InstructionWarningProlog(*this) +
-      "could not decrement variable reffered to in attribute [" +
-      Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME + "]";
-    LogWarning(ui, warning);
-    return ExecutionStatus::FAILURE;
-  }
-  if (!SetValueFromAttributeName(*this, ws, ui, Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME,
-                                 value))
+    decremented = sup::dto::Decrement(value);
+    return decremented;
+  };
+  if (!UpdateValueFromAttributeName(*this, ws, ui, Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME,
+                                    func))
   {
+    if (!decremented)
+    {
+      const std::string warning = InstructionWarningProlog(*this) +
+        "could not decrement variable reffered to in attribute [" +
+        Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME + "]";
+      LogWarning(ui, warning);
+    }
     return ExecutionStatus::FAILURE;
   }
   return ExecutionStatus::SUCCESS;
 }
 
+bool Decrement::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -35,15 +35,24 @@ const std::string Equals::Type = "Equals";
 
 Equals::Equals()
   : Instruction(Equals::Type)
+  , m_array_mode{ArrayComparisonMode::kNone}
 {
   AddAttributeDefinition(Constants::LEFT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
   AddAttributeDefinition(Constants::RIGHT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::ARRAY_MODE_ATTRIBUTE_NAME);
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName);
 }
 
 Equals::~Equals() = default;
 
+void Equals::SetupImpl(const Procedure&)
+{
+  m_array_mode = ParseArrayComparisonMode(*this);
+}
+
 ExecutionStatus Equals::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
   sup::dto::AnyValue lhs;
@@ -56,9 +65,19 @@ ExecutionStatus Equals::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   {
     return ExecutionStatus::FAILURE;
   }
+  if (m_array_mode != ArrayComparisonMode::kNone)
+  {
+    return ExecuteArrayComparison(*this, ui, ws, lhs, rhs, ComparisonOperator::kEqual,
+                                  m_array_mode);
+  }
   return lhs == rhs ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
 }
 
+bool Equals::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
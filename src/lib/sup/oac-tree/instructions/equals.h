@@ -23,6 +23,8 @@
 #ifndef SUP_OAC_TREE_EQUALS_H_
 #define SUP_OAC_TREE_EQUALS_H_
 
+#include "array_comparison.h"
+
 #include <sup/oac-tree/instruction.h>
 
 namespace sup
@@ -33,6 +35,9 @@ namespace oac_tree
  * @brief Instruction checking the equality of two variables
  *
  * @details Check equality of variables identified with 'lhs' and 'rhs' attributes.
+ *
+ * The optional 'arrayMode' attribute enables element-wise comparison of numeric arrays (see
+ * ArrayComparisonMode).
  */
 class Equals : public Instruction
 {
@@ -44,7 +49,13 @@ public:
   static const std::string Type;
 
 private:
+  void SetupImpl(const Procedure& proc) override;
+
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  ArrayComparisonMode m_array_mode;
 };
 
 }  // namespace oac_tree
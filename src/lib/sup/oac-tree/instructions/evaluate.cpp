@@ -0,0 +1,101 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "evaluate.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string Evaluate::Type = "Evaluate";
+
+Evaluate::Evaluate()
+  : Instruction(Evaluate::Type)
+  , m_expression{}
+{
+  AddAttributeDefinition(Constants::EXPRESSION_ATTRIBUTE_NAME).SetMandatory();
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName);
+}
+
+Evaluate::~Evaluate() = default;
+
+void Evaluate::SetupImpl(const Procedure& proc)
+{
+  try
+  {
+    m_expression = CompiledExpression{GetAttributeString(Constants::EXPRESSION_ATTRIBUTE_NAME)};
+  }
+  catch (const ParseException& e)
+  {
+    std::string error_message = InstructionSetupExceptionProlog(*this) + e.what();
+    throw InstructionSetupException(error_message);
+  }
+  const auto& ws = proc.GetWorkspace();
+  for (const auto& var_name : m_expression.VariableNames())
+  {
+    auto root_name = SplitFieldName(var_name).first;
+    if (!ws.HasVariable(root_name))
+    {
+      std::string error_message = InstructionSetupExceptionProlog(*this) +
+        "workspace does not contain variable with name [" + root_name + "]";
+      throw InstructionSetupException(error_message);
+    }
+  }
+}
+
+ExecutionStatus Evaluate::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  ExpressionValue result{};
+  std::string error;
+  if (!m_expression.Evaluate(ws, result, error))
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "could not evaluate expression [" +
+      GetAttributeString(Constants::EXPRESSION_ATTRIBUTE_NAME) + "]: " + error;
+    LogWarning(ui, warning_message);
+    return ExecutionStatus::FAILURE;
+  }
+  if (!HasAttribute(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME))
+  {
+    return IsTrue(result) ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
+  }
+  return SetValueFromAttributeName(*this, ws, ui, Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME,
+                                   ToAnyValue(result))
+           ? ExecutionStatus::SUCCESS
+           : ExecutionStatus::FAILURE;
+}
+
+bool Evaluate::IsNonBlockingImpl() const
+{
+  return true;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
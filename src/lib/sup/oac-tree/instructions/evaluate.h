@@ -0,0 +1,66 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_EVALUATE_H_
+#define SUP_OAC_TREE_EVALUATE_H_
+
+#include "compiled_expression.h"
+
+#include <sup/oac-tree/instruction.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Instruction that evaluates an arithmetic or boolean expression over workspace variables.
+ *
+ * @details The 'expression' attribute is parsed once during setup (see CompiledExpression), so
+ * executing the instruction only reads the referenced variables and evaluates the expression tree.
+ * Without the optional 'outputVar' attribute, the instruction returns SUCCESS if the result is
+ * true or different from zero and FAILURE otherwise. With 'outputVar', the result is written to
+ * that variable and the instruction returns SUCCESS if that succeeded.
+ */
+class Evaluate : public Instruction
+{
+public:
+  Evaluate();
+
+  ~Evaluate() override;
+
+  static const std::string Type;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  CompiledExpression m_expression;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_EVALUATE_H_
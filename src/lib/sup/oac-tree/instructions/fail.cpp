@@ -46,6 +46,11 @@ ExecutionStatus Fail::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return ExecutionStatus::FAILURE;
 }
 
+bool Fail::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
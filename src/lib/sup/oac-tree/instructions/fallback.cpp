@@ -30,24 +30,22 @@ const std::string Fallback::Type = "Fallback";
 
 Fallback::Fallback()
   : CompoundInstruction(Fallback::Type)
+  , m_cursor{0}
 {}
 
 Fallback::~Fallback() = default;
 
 ExecutionStatus Fallback::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  for (auto instruction : ChildInstructions())
+  m_cursor = SkipFailedChildren(m_cursor);
+  if (m_cursor < NumberOfChildren())
   {
-    auto child_status = instruction->GetStatus();
-    if (child_status == ExecutionStatus::FAILURE)
-    {
-      continue;
-    }
-    if (NeedsExecute(child_status))
+    auto instruction = ChildAt(m_cursor);
+    if (NeedsExecute(instruction->GetStatus()))
     {
       instruction->ExecuteSingle(ui, ws);
-      break;
     }
+    m_cursor = SkipFailedChildren(m_cursor);
   }
   return CalculateCompoundStatus();
 }
@@ -55,41 +53,45 @@ ExecutionStatus Fallback::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 std::vector<const Instruction*> Fallback::NextInstructionsImpl() const
 {
   std::vector<const Instruction*> result;
-  for (auto instruction : ChildInstructions())
+  auto idx = SkipFailedChildren(m_cursor);
+  if (idx < NumberOfChildren() && ReadyForExecute(ChildAt(idx)->GetStatus()))
   {
-    auto child_status = instruction->GetStatus();
-    if (child_status == ExecutionStatus::FAILURE)
-    {
-      continue;
-    }
-    if (ReadyForExecute(child_status))
-    {
-      result.push_back(instruction);
-      return result;
-    }
-    // There is no next when a child is encountered that has status SUCCESS/RUNNING:
-    break;
+    result.push_back(ChildAt(idx));
   }
+  // There is no next when a child is encountered that has status SUCCESS/RUNNING.
   return result;
 }
 
+void Fallback::ResetHook(UserInterface& ui)
+{
+  m_cursor = 0;
+  ResetChildren(ui);
+}
+
+std::size_t Fallback::SkipFailedChildren(std::size_t idx) const
+{
+  const auto n_children = NumberOfChildren();
+  while (idx < n_children && ChildAt(idx)->GetStatus() == ExecutionStatus::FAILURE)
+  {
+    ++idx;
+  }
+  return idx;
+}
+
 ExecutionStatus Fallback::CalculateCompoundStatus() const
 {
-  for (auto instruction : ChildInstructions())
+  auto idx = SkipFailedChildren(m_cursor);
+  if (idx == NumberOfChildren())
   {
-    auto child_status = instruction->GetStatus();
-    if (child_status == ExecutionStatus::FAILURE)
-    {
-      continue;
-    }
-    if (child_status == ExecutionStatus::NOT_STARTED
-        || child_status == ExecutionStatus::NOT_FINISHED)
-    {
-      return ExecutionStatus::NOT_FINISHED;
-    }
-    return child_status;
+    return ExecutionStatus::FAILURE;
+  }
+  auto child_status = ChildAt(idx)->GetStatus();
+  if (child_status == ExecutionStatus::NOT_STARTED
+      || child_status == ExecutionStatus::NOT_FINISHED)
+  {
+    return ExecutionStatus::NOT_FINISHED;
   }
-  return ExecutionStatus::FAILURE;
+  return child_status;
 }
 
 }  // namespace oac_tree
@@ -22,6 +22,7 @@
 
 #include "for.h"
 
+#include <sup/oac-tree/concrete_constraints.h>
 #include <sup/oac-tree/constants.h>
 #include <sup/oac-tree/execution_status.h>
 #include <sup/oac-tree/instruction.h>
@@ -31,6 +32,7 @@
 
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
 #include <sup/oac-tree/exceptions.h>
 #include <sup/oac-tree/generic_utils.h>
 
@@ -43,12 +45,26 @@ const std::string ForInstruction::Type = "For";
 ForInstruction::ForInstruction()
   : DecoratorInstruction(ForInstruction::Type)
   , m_count{0}
+  , m_max_count{0}
+  , m_element_var_name{}
   , m_array{}
+  , m_element{}
+  , m_start{0}
+  , m_step{1}
 {
   AddAttributeDefinition(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME)
-    .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+    .SetCategory(AttributeCategory::kVariableName);
   AddAttributeDefinition(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::START_ATTRIBUTE_NAME, sup::dto::SignedInteger64Type)
+    .SetCategory(AttributeCategory::kBoth);
+  AddAttributeDefinition(Constants::STOP_ATTRIBUTE_NAME, sup::dto::SignedInteger64Type)
+    .SetCategory(AttributeCategory::kBoth);
+  AddAttributeDefinition(Constants::STEP_ATTRIBUTE_NAME, sup::dto::SignedInteger64Type)
+    .SetCategory(AttributeCategory::kBoth);
+  AddConstraint(
+    MakeConstraint<Xor>(MakeConstraint<Exists>(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME),
+                        MakeConstraint<Exists>(Constants::STOP_ATTRIBUTE_NAME)));
 }
 
 ForInstruction::~ForInstruction() = default;
@@ -56,77 +72,168 @@ ForInstruction::~ForInstruction() = default;
 bool ForInstruction::InitHook(UserInterface& ui, Workspace& ws)
 {
   m_count = 0;
-  if (!GetAttributeValue(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, m_array))
+  m_max_count = 0;
+  m_element_var_name = GetAttributeString(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME);
+  if (HasAttribute(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME))
   {
-    return false;
+    return InitArray(ui, ws);
   }
-  return true;
+  return InitRange(ui, ws);
 }
 
 ExecutionStatus ForInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  if (!sup::dto::IsArrayValue(m_array))
+  if (m_max_count == 0)
+  {
+    return ExecutionStatus::SUCCESS;
+  }
+  auto child_status = GetChildStatus();
+  // Only write the element variable when the child instruction starts on a new element.
+  if (child_status == ExecutionStatus::NOT_STARTED || child_status == ExecutionStatus::SUCCESS)
+  {
+    if (!WriteElement(ws))
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "Could not write current element value to element variable with name [" +
+        m_element_var_name + "]";
+      LogWarning(ui, warning_message);
+      return ExecutionStatus::FAILURE;
+    }
+    if (child_status == ExecutionStatus::SUCCESS)
+    {
+      ResetChild(ui);
+    }
+  }
+  ExecuteChild(ui, ws);
+
+  child_status = GetChildStatus();
+  if (child_status == ExecutionStatus::SUCCESS || child_status == ExecutionStatus::FAILURE)
+  {
+    m_count++;
+  }
+  return CalculateStatus();
+}
+
+bool ForInstruction::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
+bool ForInstruction::CompletesSynchronouslyImpl() const
+{
+  return ChildCompletesSynchronously();
+}
+
+void ForInstruction::ResetHook(UserInterface& ui)
+{
+  m_array.reset();
+  ResetChild(ui);
+}
+
+bool ForInstruction::InitArray(UserInterface& ui, Workspace& ws)
+{
+  auto array_var_name = GetAttributeString(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME);
+  m_array = ws.GetSnapshot(array_var_name);
+  if (!m_array)
   {
     std::string warning_message = InstructionWarningProlog(*this) +
-      "For instruction expects an array but variable with name [" +
-      GetAttributeString(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME) + "] is not one.";
+      "could not read array variable with name [" + array_var_name + "] from workspace";
     LogWarning(ui, warning_message);
-    return ExecutionStatus::FAILURE;
+    return false;
   }
-  int max_count = m_array.NumberOfElements();
-  if (max_count == 0)
+  if (!sup::dto::IsArrayValue(*m_array))
   {
-    return ExecutionStatus::SUCCESS;
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "For instruction expects an array but variable with name [" + array_var_name +
+      "] is not one.";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  m_max_count = m_array->NumberOfElements();
+  if (m_max_count == 0)
+  {
+    return true;
   }
-  dto::AnyValue element_val;
+  // The element type is checked once, instead of for each element.
+  sup::dto::AnyValue element_val;
   if (!GetAttributeValue(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, element_val))
   {
-    return ExecutionStatus::FAILURE;
+    return false;
   }
-  if (element_val.GetType() != m_array.GetType().ElementType())
+  if (element_val.GetType() != m_array->GetType().ElementType())
   {
     std::string warning_message =
-      InstructionWarningProlog(*this) + "The element [" +
-      GetAttributeString(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME) + "] and the elements of array [" +
-      GetAttributeString(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME) + "] have to be of the same type.";
+      InstructionWarningProlog(*this) + "The element [" + m_element_var_name +
+      "] and the elements of array [" + array_var_name + "] have to be of the same type.";
     LogWarning(ui, warning_message);
-    return ExecutionStatus::FAILURE;
+    return false;
   }
+  return true;
+}
 
-  if (!SetValueFromAttributeName(*this, ws, ui, Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME,
-                                 m_array[m_count]))
+bool ForInstruction::InitRange(UserInterface& ui, Workspace& ws)
+{
+  m_array.reset();
+  m_start = 0;
+  m_step = 1;
+  sup::dto::int64 stop = 0;
+  if (!GetAttributeValueAs(Constants::START_ATTRIBUTE_NAME, ws, ui, m_start)
+      || !GetAttributeValueAs(Constants::STOP_ATTRIBUTE_NAME, ws, ui, stop)
+      || !GetAttributeValueAs(Constants::STEP_ATTRIBUTE_NAME, ws, ui, m_step))
+  {
+    return false;
+  }
+  if (m_step == 0)
   {
     std::string warning_message = InstructionWarningProlog(*this) +
-      "Could not write current array value to element variable with name [" +
-      GetAttributeString(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME) + "]";
+      "attribute [" + Constants::STEP_ATTRIBUTE_NAME + "] cannot be zero";
     LogWarning(ui, warning_message);
-    return ExecutionStatus::FAILURE;
+    return false;
   }
-
-  auto child_status = GetChildStatus();
-  if (child_status == ExecutionStatus::SUCCESS)
+  if (m_step > 0 && stop > m_start)
   {
-    ResetChild(ui);
+    m_max_count = static_cast<std::size_t>((stop - m_start + m_step - 1) / m_step);
   }
-  ExecuteChild(ui, ws);
-
-  child_status = GetChildStatus();
+  else if (m_step < 0 && stop < m_start)
+  {
+    m_max_count = static_cast<std::size_t>((m_start - stop - m_step - 1) / -m_step);
+  }
+  if (m_max_count == 0)
+  {
+    return true;
+  }
+  m_element = sup::dto::AnyValue{};
+  if (!GetAttributeValue(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, m_element))
+  {
+    return false;
+  }
+  if (!sup::dto::IsScalarValue(m_element))
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "element variable with name [" + m_element_var_name + "] must be a scalar in range mode";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  return true;
+}
 
-  // Don't increment count when _max_count is not strictly positive.
-  if (max_count > 0
-      && (child_status == ExecutionStatus::SUCCESS || child_status == ExecutionStatus::FAILURE))
+bool ForInstruction::WriteElement(Workspace& ws)
+{
+  if (m_array)
   {
-    m_count++;
+    return ws.SetValue(m_element_var_name, (*m_array)[m_count]);
   }
-  return CalculateStatus(max_count);
+  sup::dto::AnyValue current{static_cast<sup::dto::int64>(
+    m_start + static_cast<sup::dto::int64>(m_count) * m_step)};
+  return sup::dto::TryConvert(m_element, current) && ws.SetValue(m_element_var_name, m_element);
 }
 
-ExecutionStatus ForInstruction::CalculateStatus(int max_count) const
+ExecutionStatus ForInstruction::CalculateStatus() const
 {
   auto child_status = GetChildStatus();
   if (child_status == ExecutionStatus::SUCCESS)
   {
-    if (m_count == max_count)
+    if (m_count == m_max_count)
     {
       return ExecutionStatus::SUCCESS;
     }
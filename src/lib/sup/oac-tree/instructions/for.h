@@ -25,6 +25,10 @@
 
 #include <sup/oac-tree/decorator_instruction.h>
 
+#include <sup/dto/anyvalue.h>
+
+#include <memory>
+
 namespace sup
 {
 namespace oac_tree
@@ -35,6 +39,11 @@ namespace oac_tree
  * @details Executes the child instruction on the elements of an array, until either: the child
  * fails (FAILURE) or the child instruction is applied to all elements of the provided array
  * (SUCCESS).
+ *
+ * The array is read once, as a read-only snapshot, when the instruction starts. Instead of an
+ * array, a numeric range can be provided with the 'start' (default 0), 'stop' and 'step' (default
+ * 1) attributes. The element variable then takes the values start, start + step, ... as long as
+ * they lie before stop.
  */
 class ForInstruction : public DecoratorInstruction
 {
@@ -50,14 +59,42 @@ private:
 
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
 
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
+
+  void ResetHook(UserInterface& ui) override;
+
+  bool InitArray(UserInterface& ui, Workspace& ws);
+
+  bool InitRange(UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Write the current array element or range value to the element variable.
+   */
+  bool WriteElement(Workspace& ws);
+
   /**
    * @brief Calculate this instruction's status from the status of its child instruction
    * and the number of successful executions of the child instruction.
    */
-  ExecutionStatus CalculateStatus(int max_count) const;
+  ExecutionStatus CalculateStatus() const;
+
+  std::size_t m_count;
+  std::size_t m_max_count;
+  std::string m_element_var_name;
+
+  /**
+   * @brief Snapshot of the array, or nullptr in range mode.
+   */
+  std::shared_ptr<const sup::dto::AnyValue> m_array;
 
-  int m_count;
-  sup::dto::AnyValue m_array;
+  /**
+   * @brief Element value with the type of the element variable, reused in range mode.
+   */
+  sup::dto::AnyValue m_element;
+  sup::dto::int64 m_start;
+  sup::dto::int64 m_step;
 };
 
 }  // namespace oac_tree
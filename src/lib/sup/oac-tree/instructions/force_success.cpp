@@ -46,6 +46,16 @@ ExecutionStatus ForceSuccess::ExecuteSingleImpl(UserInterface& ui, Workspace& ws
   return status;
 }
 
+bool ForceSuccess::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
+bool ForceSuccess::CompletesSynchronouslyImpl() const
+{
+  return ChildCompletesSynchronously();
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -44,6 +44,10 @@ public:
 
 private:
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
 };
 
 }  // namespace oac_tree
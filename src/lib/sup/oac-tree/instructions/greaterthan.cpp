@@ -40,15 +40,24 @@ const std::string GreaterThan::Type = "GreaterThan";
 
 GreaterThan::GreaterThan()
   : Instruction(GreaterThan::Type)
+  , m_array_mode{ArrayComparisonMode::kNone}
 {
   AddAttributeDefinition(Constants::LEFT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
   AddAttributeDefinition(Constants::RIGHT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::ARRAY_MODE_ATTRIBUTE_NAME);
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName);
 }
 
 GreaterThan::~GreaterThan() = default;
 
+void GreaterThan::SetupImpl(const Procedure&)
+{
+  m_array_mode = ParseArrayComparisonMode(*this);
+}
+
 ExecutionStatus GreaterThan::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
   sup::dto::AnyValue lhs;
@@ -61,11 +70,21 @@ ExecutionStatus GreaterThan::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   {
     return ExecutionStatus::FAILURE;
   }
+  if (m_array_mode != ArrayComparisonMode::kNone)
+  {
+    return ExecuteArrayComparison(*this, ui, ws, lhs, rhs, ComparisonOperator::kGreaterThan,
+                                  m_array_mode);
+  }
 
   return sup::dto::Compare(lhs, rhs) == sup::dto::CompareResult::Greater ? ExecutionStatus::SUCCESS
                                                                          : ExecutionStatus::FAILURE;
 }
 
+bool GreaterThan::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -23,6 +23,8 @@
 #ifndef SUP_OAC_TREE_GREATERTHAN_H_
 #define SUP_OAC_TREE_GREATERTHAN_H_
 
+#include "array_comparison.h"
+
 #include <sup/oac-tree/instruction.h>
 
 namespace sup
@@ -34,6 +36,9 @@ namespace oac_tree
  *
  * @details Check if variable identified with 'lhs' attribute is greater than one with 'rhs'
  * attribute.
+ *
+ * The optional 'arrayMode' attribute enables element-wise comparison of numeric arrays (see
+ * ArrayComparisonMode).
  */
 class GreaterThan : public Instruction
 {
@@ -45,7 +50,13 @@ public:
   static const std::string Type;
 
 private:
+  void SetupImpl(const Procedure& proc) override;
+
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  ArrayComparisonMode m_array_mode;
 };
 
 }  // namespace oac_tree
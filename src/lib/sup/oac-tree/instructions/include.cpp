@@ -84,6 +84,16 @@ ExecutionStatus Include::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return GetChildStatus();
 }
 
+bool Include::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
+bool Include::CompletesSynchronouslyImpl() const
+{
+  return ChildCompletesSynchronously();
+}
+
 bool Include::PostInitialiseVariables(const StringAttributeList& source_attributes)
 {
   bool result = true;
@@ -49,6 +49,10 @@ private:
 
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
 
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
+
   bool PostInitialiseVariables(const StringAttributeList& source_attributes) override;
 };
 
@@ -48,27 +48,32 @@ Increment::~Increment() = default;
 
 ExecutionStatus Increment::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  sup::dto::AnyValue value;
-  if (!GetAttributeValue(Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, value))
+  bool incremented = true;
+  auto func = [&incremented](sup::dto::AnyValue& value)
   {
-    return ExecutionStatus::FAILURE;
-  }
-  if (!sup::dto::Increment(value))
-  {
-    const std::string warning = InstructionWarningProlog(*this) +
-      "could not increment variable reffered to in attribute [" +
-      Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME + "]";
-    LogWarning(ui, warning);
-    return ExecutionStatus::FAILURE;
-  }
-  if (!SetValueFromAttributeName(*this, ws, ui, Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME,
-                                 value))
+    incremented = sup::dto::Increment(value);
+    return incremented;
+  };
+  if (!UpdateValueFromAttributeName(*this, ws, ui, Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME,
+                                    func))
   {
+    if (!incremented)
+    {
+      const std::string warning = InstructionWarningProlog(*this) +
+        "could not increment variable reffered to in attribute [" +
+        Constants::GENERIC_VARIABLE_NAME_ATTRIBUTE_NAME + "]";
+      LogWarning(ui, warning);
+    }
     return ExecutionStatus::FAILURE;
   }
   return ExecutionStatus::SUCCESS;
 }
 
+bool Increment::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
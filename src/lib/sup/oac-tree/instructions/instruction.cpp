@@ -30,8 +30,6 @@
 #include <sup/oac-tree/workspace.h>
 
 #include <sup/dto/anyvalue_helper.h>
-#include <sup/dto/json_type_parser.h>
-#include <sup/dto/json_value_parser.h>
 
 namespace
 {
@@ -44,20 +42,26 @@ std::string InstructionSetupExceptionMessage(const Instruction& instruction,
 bool GetValueFromVariableName(const Instruction& instruction, const Workspace& ws,
                               UserInterface& ui, const std::string& var_name,
                               sup::dto::AnyValue& value);
+bool UpdateValueFromAttributeNameImpl(const Instruction& instruction, Workspace& ws,
+                                      UserInterface& ui, const std::string& attr_name,
+                                      const std::function<bool(sup::dto::AnyValue&)>& func,
+                                      bool in_place);
 }  // unnamed namespace
 
 namespace sup
 {
 namespace oac_tree
 {
+static_assert(std::atomic<ExecutionStatus>::is_always_lock_free,
+              "Instruction status must be readable without locking");
 
 Instruction::Instruction(const std::string &type)
     : m_type{type}
     , m_status{ExecutionStatus::NOT_STARTED}
     , m_status_before{ExecutionStatus::NOT_STARTED}
     , m_halt_requested{false}
+    , m_cancel_token{}
     , m_attribute_handler{}
-    , m_status_mutex{}
 {
   AddAttributeDefinition(Constants::NAME_ATTRIBUTE_NAME, sup::dto::StringType);
   AddAttributeDefinition(Constants::IS_ROOT_ATTRIBUTE_NAME, sup::dto::BooleanType);
@@ -94,8 +98,7 @@ void Instruction::SetName(const std::string &name)
 
 ExecutionStatus Instruction::GetStatus() const
 {
-  std::lock_guard<std::mutex> lock(m_status_mutex);
-  return m_status;
+  return m_status.load(std::memory_order_acquire);
 }
 
 void Instruction::Setup(const Procedure& proc)
@@ -123,6 +126,7 @@ void Instruction::ExecuteSingle(UserInterface& ui, Workspace& ws)
 void Instruction::Halt()
 {
   m_halt_requested.store(true);
+  m_cancel_token.Cancel();
   HaltImpl();
 }
 
@@ -137,6 +141,7 @@ void Instruction::Reset(UserInterface& ui)
   }
   m_attribute_handler.ClearFailedConstraints();
   m_halt_requested.store(false);
+  m_cancel_token.Clear();
 }
 
 bool Instruction::HasAttribute(const std::string& name) const
@@ -212,11 +217,31 @@ std::vector<const Instruction*> Instruction::ChildInstructions() const
   return ChildInstructionsImpl();
 }
 
+ChildRange Instruction::Children()
+{
+  return ChildrenImpl();
+}
+
+ConstChildRange Instruction::Children() const
+{
+  return ChildrenImpl();
+}
+
 std::vector<const Instruction*> Instruction::NextInstructions() const
 {
   return NextInstructionsImpl();
 }
 
+bool Instruction::IsNonBlocking() const
+{
+  return IsNonBlockingImpl();
+}
+
+bool Instruction::CompletesSynchronously() const
+{
+  return CompletesSynchronouslyImpl();
+}
+
 bool Instruction::InsertInstruction(std::unique_ptr<Instruction>&& child, int index)
 {
   return InsertInstructionImpl(std::move(child), index);
@@ -232,6 +257,11 @@ bool Instruction::IsHaltRequested() const
   return m_halt_requested.load();
 }
 
+const CancellationToken& Instruction::GetCancellationToken() const
+{
+  return m_cancel_token;
+}
+
 AttributeDefinition& Instruction::AddAttributeDefinition(const std::string& attr_name,
                                                          const sup::dto::AnyType& value_type)
 {
@@ -273,10 +303,14 @@ void Instruction::AddConstraint(Constraint constraint)
   return m_attribute_handler.AddConstraint(constraint);
 }
 
+void Instruction::LinkCancellationToken(Instruction& child) const
+{
+  child.m_cancel_token.SetParent(m_cancel_token);
+}
+
 void Instruction::SetStatus(ExecutionStatus status)
 {
-  std::lock_guard<std::mutex> lock(m_status_mutex);
-  m_status = status;
+  m_status.store(status, std::memory_order_release);
 }
 
 void Instruction::Preamble(UserInterface& ui, Workspace& ws)
@@ -325,6 +359,12 @@ int Instruction::ChildrenCountImpl() const
 }
 
 std::vector<const Instruction*> Instruction::ChildInstructionsImpl() const
+{
+  auto children = ChildrenImpl();
+  return { children.begin(), children.end() };
+}
+
+ChildRange Instruction::ChildrenImpl() const
 {
   return {};
 }
@@ -334,6 +374,16 @@ std::vector<const Instruction*> Instruction::NextInstructionsImpl() const
   return {};
 }
 
+bool Instruction::IsNonBlockingImpl() const
+{
+  return false;
+}
+
+bool Instruction::CompletesSynchronouslyImpl() const
+{
+  return IsNonBlocking();
+}
+
 bool Instruction::InsertInstructionImpl(std::unique_ptr<Instruction>&&, int)
 {
   return false;
@@ -404,6 +454,20 @@ bool SetValueFromAttributeName(const Instruction& instruction, Workspace& ws,
   return true;
 }
 
+bool UpdateValueFromAttributeName(const Instruction& instruction, Workspace& ws,
+                                  UserInterface& ui, const std::string& attr_name,
+                                  const std::function<bool(sup::dto::AnyValue&)>& func)
+{
+  return UpdateValueFromAttributeNameImpl(instruction, ws, ui, attr_name, func, false);
+}
+
+bool UpdateValueInPlaceFromAttributeName(const Instruction& instruction, Workspace& ws,
+                                         UserInterface& ui, const std::string& attr_name,
+                                         const std::function<bool(sup::dto::AnyValue&)>& func)
+{
+  return UpdateValueFromAttributeNameImpl(instruction, ws, ui, attr_name, func, true);
+}
+
 sup::dto::AnyValue ParseAnyValueAttributePair(const Instruction& instruction,
                                               const Workspace& ws,
                                               UserInterface& ui,
@@ -411,19 +475,17 @@ sup::dto::AnyValue ParseAnyValueAttributePair(const Instruction& instruction,
                                               const std::string& value_attr_name)
 {
   auto type_str = instruction.GetAttributeString(type_attr_name);
-  sup::dto::JSONAnyTypeParser type_parser;
-  const auto& registry = ws.GetTypeRegistry();
-  if (!type_parser.ParseString(type_str, std::addressof(registry)))
+  sup::dto::AnyType anytype;
+  if (!ws.ParseType(type_str, anytype))
   {
     std::string error_message = InstructionErrorProlog(instruction) +
       "could not parse type [" + type_str + "] from attribute [" + type_attr_name + "]";
     LogError(ui, error_message);
     return {};
   }
-  sup::dto::AnyType anytype = type_parser.MoveAnyType();
   auto val_str = instruction.GetAttributeString(value_attr_name);
-  sup::dto::JSONAnyValueParser val_parser;
-  if (!val_parser.TypedParseString(anytype, val_str))
+  sup::dto::AnyValue result;
+  if (!ws.ParseValue(type_str, val_str, result))
   {
     std::string error_message = InstructionErrorProlog(instruction) +
       "could not parse value [" + val_str + "] from attribute [" + value_attr_name +
@@ -431,7 +493,7 @@ sup::dto::AnyValue ParseAnyValueAttributePair(const Instruction& instruction,
     LogError(ui, error_message);
     return {};
   }
-  return val_parser.MoveAnyValue();
+  return result;
 }
 
 std::vector<std::string> GetDefinedAttributeNames(const Instruction& instruction)
@@ -512,4 +574,46 @@ bool GetValueFromVariableName(const Instruction& instruction, const Workspace& w
   return true;
 }
 
+bool UpdateValueFromAttributeNameImpl(const Instruction& instruction, Workspace& ws,
+                                      UserInterface& ui, const std::string& attr_name,
+                                      const std::function<bool(sup::dto::AnyValue&)>& func,
+                                      bool in_place)
+{
+  auto output_field_name = instruction.GetAttributeString(attr_name);
+  if (output_field_name.empty())
+  {
+    std::string error_message = InstructionErrorProlog(instruction) +
+      "trying to use variable with empty name";
+    LogError(ui, error_message);
+    return false;
+  }
+  auto output_var_name = sup::oac_tree::SplitFieldName(output_field_name).first;
+  if (!ws.HasVariable(output_var_name))
+  {
+    std::string error_message = InstructionErrorProlog(instruction) +
+      "workspace does not contain output variable with name [" + output_var_name + "]";
+    LogError(ui, error_message);
+    return false;
+  }
+  bool func_result = true;
+  auto wrapped_func = [&func, &func_result](sup::dto::AnyValue& value)
+  {
+    func_result = func(value);
+    return func_result;
+  };
+  auto updated = in_place ? ws.UpdateValueInPlace(output_field_name, wrapped_func)
+                          : ws.UpdateValue(output_field_name, wrapped_func);
+  if (!updated)
+  {
+    if (func_result)
+    {
+      std::string warning_message = InstructionWarningProlog(instruction) +
+        "could not update field with name [" + output_field_name + "] in workspace";
+      LogWarning(ui, warning_message);
+    }
+    return false;
+  }
+  return true;
+}
+
 }  // unnamed namespace
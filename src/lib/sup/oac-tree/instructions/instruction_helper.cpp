@@ -22,6 +22,10 @@
 
 #include "instruction_helper.h"
 
+#include "async.h"
+#include "parallel_for.h"
+#include "parallel_sequence.h"
+
 #include <sup/oac-tree/compound_instruction.h>
 #include <sup/oac-tree/decorator_instruction.h>
 
@@ -29,6 +33,7 @@
 #include <sup/oac-tree/instruction_registry.h>
 
 #include <algorithm>
+#include <memory>
 
 namespace
 {
@@ -91,6 +96,52 @@ std::unique_ptr<Instruction> CloneInstruction(const Instruction* instruction)
   return std::move(result);
 }
 
+const Instruction* FindThreadedInstruction(const Instruction& instruction)
+{
+  auto type = instruction.GetType();
+  if (type == ParallelSequence::Type || type == Async::Type || type == ParallelFor::Type)
+  {
+    return std::addressof(instruction);
+  }
+  for (auto child : instruction.ChildInstructions())
+  {
+    if (auto threaded = FindThreadedInstruction(*child))
+    {
+      return threaded;
+    }
+  }
+  return nullptr;
+}
+
+bool InitThresholds(const Instruction& instruction, sup::dto::uint32 N, UserInterface& ui,
+                    Workspace& ws, sup::dto::uint32& success_th, sup::dto::uint32& failure_th)
+{
+  success_th = N;
+  // Literal attributes can't fail:
+  if (!instruction.GetAttributeValueAs(Constants::SUCCESS_THRESHOLD_ATTRIBUTE_NAME, ws, ui,
+                                       success_th))
+  {
+    return false;
+  }
+  success_th = std::min(N, success_th);
+  failure_th = 1;
+  if (!instruction.GetAttributeValueAs(Constants::FAILURE_THRESHOLD_ATTRIBUTE_NAME, ws, ui,
+                                       failure_th))
+  {
+    return false;
+  }
+  failure_th = std::min(N, failure_th);
+  if (instruction.HasAttribute(Constants::SUCCESS_THRESHOLD_ATTRIBUTE_NAME))
+  {
+    failure_th = std::min(failure_th, N - success_th + 1);
+  }
+  else if (instruction.HasAttribute(Constants::FAILURE_THRESHOLD_ATTRIBUTE_NAME))
+  {
+    success_th = N + 1 - failure_th;
+  }
+  return true;
+}
+
 bool InitialisePlaceholderAttributes(Instruction& instruction,
                                   const StringAttributeList& source_attributes)
 {
@@ -51,6 +51,38 @@ const Instruction* FindInstruction(const std::vector<const Instruction*>& instru
  */
 std::unique_ptr<Instruction> CloneInstruction(const Instruction* instruction);
 
+/**
+ * @brief Find an instruction in a tree that executes instructions on threads of its own.
+ *
+ * @details These are instructions of type ParallelSequence, Async and ParallelFor. State that the
+ * workspace keeps per thread, i.e. transactions and local bindings, is not visible to the
+ * instructions they execute.
+ *
+ * @param instruction Root of the instruction tree to search.
+ *
+ * @return The first such instruction or nullptr if there is none.
+ */
+const Instruction* FindThreadedInstruction(const Instruction& instruction);
+
+/**
+ * @brief Initialize the success and failure thresholds of an instruction with N branches.
+ *
+ * @details The thresholds are read from the successThreshold and failureThreshold attributes and
+ * limited to N. When only one of them is present, the other one is derived from it, so that the
+ * instruction finishes as soon as its outcome is known.
+ *
+ * @param instruction Instruction whose attributes are read.
+ * @param N Number of branches.
+ * @param ui UserInterface to log warnings.
+ * @param ws Workspace to resolve attributes that refer to variables.
+ * @param success_th Success threshold to initialize.
+ * @param failure_th Failure threshold to initialize.
+ *
+ * @return true on success.
+ */
+bool InitThresholds(const Instruction& instruction, sup::dto::uint32 N, UserInterface& ui,
+                    Workspace& ws, sup::dto::uint32& success_th, sup::dto::uint32& failure_th);
+
 /**
  * @brief Initialize variable attributes.
  *
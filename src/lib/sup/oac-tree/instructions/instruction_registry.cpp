@@ -25,12 +25,15 @@
 #include "add_element.h"
 #include "add_member.h"
 #include "async.h"
+#include "atomic_sequence.h"
 #include "choice.h"
 #include "condition.h"
 #include "copy_from_procedure.h"
 #include "copy_to_procedure.h"
 #include "copy.h"
+#include "copy_many.h"
 #include "equals.h"
+#include "evaluate.h"
 #include "var_exists.h"
 #include "decrement.h"
 #include "fail.h"
@@ -48,15 +51,19 @@
 #include "lessthanorequal.h"
 #include "listen.h"
 #include "log_instruction.h"
+#include "memoize.h"
 #include "message.h"
 #include "output.h"
+#include "parallel_for.h"
 #include "parallel_sequence.h"
+#include "periodic.h"
 #include "reactive_fallback.h"
 #include "reactive_sequence.h"
 #include "repeat.h"
 #include "reset_variable.h"
 #include "sequence.h"
 #include "succeed.h"
+#include "timeout.h"
 #include "user_choice.h"
 #include "user_confirmation.h"
 #include "wait.h"
@@ -130,6 +137,7 @@ bool InstructionRegistry::IsRegisteredInstructionName(const std::string& name) c
 void InitInstructionRegistry(InstructionRegistry& registry)
 {
   // Register compound instructions:
+  (void)RegisterInstruction<AtomicSequence>(registry);
   (void)RegisterInstruction<Choice>(registry);
   (void)RegisterInstruction<Fallback>(registry);
   (void)RegisterInstruction<ParallelSequence>(registry);
@@ -146,7 +154,11 @@ void InitInstructionRegistry(InstructionRegistry& registry)
   (void)RegisterInstruction<IncludeProcedure>(registry);
   (void)RegisterInstruction<Inverter>(registry);
   (void)RegisterInstruction<Listen>(registry);
+  (void)RegisterInstruction<Memoize>(registry);
+  (void)RegisterInstruction<ParallelFor>(registry);
+  (void)RegisterInstruction<Periodic>(registry);
   (void)RegisterInstruction<Repeat>(registry);
+  (void)RegisterInstruction<Timeout>(registry);
 
   // Register leaf instructions:
   (void)RegisterInstruction<AddElement>(registry);
@@ -155,8 +167,10 @@ void InitInstructionRegistry(InstructionRegistry& registry)
   (void)RegisterInstruction<CopyFromProcedureInstruction>(registry);
   (void)RegisterInstruction<CopyToProcedureInstruction>(registry);
   (void)RegisterInstruction<Copy>(registry);
+  (void)RegisterInstruction<CopyMany>(registry);
   (void)RegisterInstruction<Decrement>(registry);
   (void)RegisterInstruction<Equals>(registry);
+  (void)RegisterInstruction<Evaluate>(registry);
   (void)RegisterInstruction<Fail>(registry);
   (void)RegisterInstruction<GreaterThan>(registry);
   (void)RegisterInstruction<GreaterThanOrEqual>(registry);
@@ -44,6 +44,16 @@ ExecutionStatus Inverter::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return CalculateStatus();
 }
 
+bool Inverter::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
+bool Inverter::CompletesSynchronouslyImpl() const
+{
+  return ChildCompletesSynchronously();
+}
+
 ExecutionStatus Inverter::CalculateStatus() const
 {
   auto child_status = GetChildStatus();
@@ -45,6 +45,10 @@ public:
 private:
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
 
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
+
   /**
    * @brief Calculate this instruction's status from the status of its child instruction.
    */
@@ -43,15 +43,24 @@ const std::string LessThan::Type = "LessThan";
 
 LessThan::LessThan()
   : Instruction(LessThan::Type)
+  , m_array_mode{ArrayComparisonMode::kNone}
 {
   AddAttributeDefinition(Constants::LEFT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
   AddAttributeDefinition(Constants::RIGHT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::ARRAY_MODE_ATTRIBUTE_NAME);
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName);
 }
 
 LessThan::~LessThan() = default;
 
+void LessThan::SetupImpl(const Procedure&)
+{
+  m_array_mode = ParseArrayComparisonMode(*this);
+}
+
 ExecutionStatus LessThan::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
   sup::dto::AnyValue lhs;
@@ -64,11 +73,21 @@ ExecutionStatus LessThan::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   {
     return ExecutionStatus::FAILURE;
   }
+  if (m_array_mode != ArrayComparisonMode::kNone)
+  {
+    return ExecuteArrayComparison(*this, ui, ws, lhs, rhs, ComparisonOperator::kLessThan,
+                                  m_array_mode);
+  }
 
   return sup::dto::Compare(lhs, rhs) == sup::dto::CompareResult::Less ? ExecutionStatus::SUCCESS
                                                                       : ExecutionStatus::FAILURE;
 }
 
+bool LessThan::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
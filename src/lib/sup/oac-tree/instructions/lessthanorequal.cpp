@@ -43,15 +43,24 @@ const std::string LessThanOrEqual::Type = "LessThanOrEqual";
 
 LessThanOrEqual::LessThanOrEqual()
   : Instruction(LessThanOrEqual::Type)
+  , m_array_mode{ArrayComparisonMode::kNone}
 {
   AddAttributeDefinition(Constants::LEFT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
   AddAttributeDefinition(Constants::RIGHT_VARIABLE_NAME_ATTRIBUTE_NAME)
     .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::ARRAY_MODE_ATTRIBUTE_NAME);
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName);
 }
 
 LessThanOrEqual::~LessThanOrEqual() = default;
 
+void LessThanOrEqual::SetupImpl(const Procedure&)
+{
+  m_array_mode = ParseArrayComparisonMode(*this);
+}
+
 ExecutionStatus LessThanOrEqual::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
   sup::dto::AnyValue lhs;
@@ -64,6 +73,11 @@ ExecutionStatus LessThanOrEqual::ExecuteSingleImpl(UserInterface& ui, Workspace&
   {
     return ExecutionStatus::FAILURE;
   }
+  if (m_array_mode != ArrayComparisonMode::kNone)
+  {
+    return ExecuteArrayComparison(*this, ui, ws, lhs, rhs, ComparisonOperator::kLessThanOrEqual,
+                                  m_array_mode);
+  }
 
   sup::dto::CompareResult result = sup::dto::Compare(lhs, rhs);
 
@@ -72,6 +86,11 @@ ExecutionStatus LessThanOrEqual::ExecuteSingleImpl(UserInterface& ui, Workspace&
              : ExecutionStatus::FAILURE;
 }
 
+bool LessThanOrEqual::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -26,6 +26,8 @@
 #include <sup/oac-tree/exceptions.h>
 #include <sup/oac-tree/instruction_utils.h>
 
+#include <set>
+
 namespace sup
 {
 namespace oac_tree
@@ -36,6 +38,8 @@ Listen::Listen()
   : DecoratorInstruction(Listen::Type)
   , m_force_success{false}
   , m_var_cache{}
+  , m_dirty{true}
+  , m_cb_guard{}
 {
   AddAttributeDefinition(Constants::VARIABLE_NAMES_ATTRIBUTE_NAME).SetMandatory();
   AddAttributeDefinition(Constants::FORCE_SUCCESS_ATTRIBUTE_NAME, sup::dto::BooleanType)
@@ -53,6 +57,23 @@ bool Listen::InitHook(UserInterface& ui, Workspace& ws)
   {
     return false;
   }
+  // Set the flag before registering, so the initial values are always read.
+  m_dirty = true;
+  m_cb_guard = ws.GetCallbackGuard(this);
+  auto callback = [this, &ws](const sup::dto::AnyValue&, bool)
+  {
+    m_dirty = true;
+    ws.RequestTick();
+  };
+  std::set<std::string> registered;
+  for (const auto& var_name : var_names)
+  {
+    auto root_name = SplitFieldName(var_name).first;
+    if (registered.insert(root_name).second)
+    {
+      (void)ws.RegisterCallback(root_name, callback, this);
+    }
+  }
   return true;
 }
 
@@ -72,6 +93,12 @@ ExecutionStatus Listen::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   {
     ResetChild(ui);
   }
+  // Only read the variables after an update was signalled. Clear the flag first, so updates that
+  // arrive while reading are not lost.
+  if (!m_dirty.exchange(false))
+  {
+    return ExecutionStatus::RUNNING;
+  }
   auto cache_changed = UpdateVariableCache(ws);
   if (!cache_changed)
   {
@@ -83,8 +110,10 @@ ExecutionStatus Listen::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 
 void Listen::ResetHook(UserInterface& ui)
 {
+  m_cb_guard = ScopeGuard{};
   m_force_success = false;
   m_var_cache.clear();
+  m_dirty = true;
   ResetChild(ui);
 }
 
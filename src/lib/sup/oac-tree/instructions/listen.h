@@ -27,6 +27,7 @@
 
 #include <sup/oac-tree/workspace.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <map>
 #include <memory>
@@ -52,6 +53,21 @@ private:
   bool m_force_success;
   std::map<std::string, sup::dto::AnyValue> m_var_cache;
 
+  /**
+   * @brief Flag that indicates one of the listened variables was updated since the variable cache
+   * was last refreshed.
+   */
+  std::atomic<bool> m_dirty;
+
+  /**
+   * @brief Guard that unregisters the workspace callbacks.
+   */
+  ScopeGuard m_cb_guard;
+
+  /**
+   * @brief Register workspace callbacks for the listened variables. These set the dirty flag and
+   * request a new tick, so the variables are only read again after an update.
+   */
   bool InitHook(UserInterface& ui, Workspace& ws) override;
 
   /**
@@ -62,6 +78,9 @@ private:
    */
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
 
+  /**
+   * @brief Unregister the workspace callbacks.
+   */
   void ResetHook(UserInterface& ui) override;
 
   void InitVariableCache(const std::vector<std::string>& var_names);
@@ -0,0 +1,159 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "memoize.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string Memoize::Type = "Memoize";
+
+Memoize::Memoize()
+  : DecoratorInstruction(Memoize::Type)
+  , m_input_names{}
+  , m_output_names{}
+  , m_cached_inputs{}
+  , m_cached_outputs{}
+  , m_cached_status{ExecutionStatus::NOT_STARTED}
+  , m_cache_valid{false}
+{
+  AddAttributeDefinition(Constants::INPUT_VARIABLE_NAMES_ATTRIBUTE_NAME).SetMandatory();
+  AddAttributeDefinition(Constants::OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME);
+}
+
+Memoize::~Memoize() = default;
+
+void Memoize::SetupImpl(const Procedure& proc)
+{
+  SetupChild(proc);
+  m_input_names = instruction_utils::VariableNamesFromAttribute(
+    *this, Constants::INPUT_VARIABLE_NAMES_ATTRIBUTE_NAME);
+  m_output_names.clear();
+  if (HasAttribute(Constants::OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME))
+  {
+    m_output_names = instruction_utils::VariableNamesFromAttribute(
+      *this, Constants::OUTPUT_VARIABLE_NAMES_ATTRIBUTE_NAME);
+  }
+  m_cached_inputs.clear();
+  m_cached_outputs.clear();
+  m_cached_status = ExecutionStatus::NOT_STARTED;
+  m_cache_valid = false;
+}
+
+ExecutionStatus Memoize::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  if (GetChildStatus() == ExecutionStatus::NOT_STARTED)
+  {
+    std::vector<sup::dto::AnyValue> inputs;
+    if (!ReadValues(ui, ws, m_input_names, inputs))
+    {
+      return ExecutionStatus::FAILURE;
+    }
+    if (m_cache_valid && inputs == m_cached_inputs)
+    {
+      if (m_cached_status != ExecutionStatus::SUCCESS)
+      {
+        return m_cached_status;
+      }
+      return ReplayOutputs(ui, ws) ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
+    }
+    // Inputs changed: the child needs to run and only its completion will validate the cache again.
+    m_cache_valid = false;
+    m_cached_inputs = std::move(inputs);
+  }
+  ExecuteChild(ui, ws);
+  auto child_status = GetChildStatus();
+  if (child_status == ExecutionStatus::SUCCESS)
+  {
+    m_cached_status = child_status;
+    m_cache_valid = ReadValues(ui, ws, m_output_names, m_cached_outputs);
+  }
+  else if (child_status == ExecutionStatus::FAILURE && !IsHaltRequested())
+  {
+    m_cached_status = child_status;
+    m_cached_outputs.clear();
+    m_cache_valid = true;
+  }
+  return child_status;
+}
+
+bool Memoize::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
+bool Memoize::CompletesSynchronouslyImpl() const
+{
+  return ChildCompletesSynchronously();
+}
+
+bool Memoize::ReadValues(UserInterface& ui, Workspace& ws,
+                         const std::vector<std::string>& var_names,
+                         std::vector<sup::dto::AnyValue>& values) const
+{
+  values.clear();
+  values.reserve(var_names.size());
+  for (const auto& var_name : var_names)
+  {
+    sup::dto::AnyValue value;
+    if (!ws.GetValue(var_name, value))
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "could not read variable with name [" + var_name + "] from workspace";
+      LogWarning(ui, warning_message);
+      return false;
+    }
+    values.push_back(std::move(value));
+  }
+  return true;
+}
+
+bool Memoize::ReplayOutputs(UserInterface& ui, Workspace& ws) const
+{
+  for (std::size_t idx = 0; idx < m_output_names.size(); ++idx)
+  {
+    const auto& output_name = m_output_names[idx];
+    sup::dto::AnyValue current;
+    if (ws.GetValue(output_name, current) && current == m_cached_outputs[idx])
+    {
+      continue;
+    }
+    if (!ws.SetValue(output_name, m_cached_outputs[idx]))
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "could not write variable with name [" + output_name + "] to workspace";
+      LogWarning(ui, warning_message);
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_MEMOIZE_H_
+#define SUP_OAC_TREE_MEMOIZE_H_
+
+#include <sup/oac-tree/decorator_instruction.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Decorator that skips its child when the variables it depends on did not change since
+ * its last execution.
+ *
+ * @details The 'inputVars' attribute lists the variables the child reads and the optional
+ * 'outputVars' attribute lists the variables it produces (comma separated). When the child
+ * finishes, the input values from the start of that run and its status are recorded, together
+ * with the resulting output values when it succeeded. When a later execution starts with the same
+ * input values, the child is not executed: after a recorded success, the recorded output values
+ * are written back (only where they differ) and the decorator succeeds immediately, while after a
+ * recorded failure the decorator fails immediately without writing any outputs. A halted child
+ * does not update the cache, which is cleared during setup.
+ *
+ * The child is assumed to be a pure function of the listed input variables.
+ */
+class Memoize : public DecoratorInstruction
+{
+public:
+  Memoize();
+
+  ~Memoize() override;
+
+  static const std::string Type;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
+
+  bool ReadValues(UserInterface& ui, Workspace& ws, const std::vector<std::string>& var_names,
+                  std::vector<sup::dto::AnyValue>& values) const;
+
+  bool ReplayOutputs(UserInterface& ui, Workspace& ws) const;
+
+  std::vector<std::string> m_input_names;
+  std::vector<std::string> m_output_names;
+  std::vector<sup::dto::AnyValue> m_cached_inputs;
+  std::vector<sup::dto::AnyValue> m_cached_outputs;
+  ExecutionStatus m_cached_status;
+  bool m_cache_valid;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_MEMOIZE_H_
@@ -0,0 +1,388 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "parallel_for.h"
+
+#include "instruction_helper.h"
+
+#include <sup/oac-tree/attribute_utils.h>
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue_helper.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+const sup::dto::uint32 DEFAULT_MAX_CONCURRENCY = 4;
+
+/**
+ * @brief User interface for the copies of the child instruction tree. These are unknown to the
+ * user interface, so their status updates are not forwarded.
+ */
+class WorkerUserInterface : public sup::oac_tree::UserInterface
+{
+public:
+  explicit WorkerUserInterface(sup::oac_tree::UserInterface& ui);
+  ~WorkerUserInterface() override;
+
+  void UpdateInstructionStatus(const sup::oac_tree::Instruction* instruction) override;
+  void VariableUpdated(const std::string& name, const sup::dto::AnyValue& value,
+                       bool connected) override;
+  bool PutValue(const sup::dto::AnyValue& value, const std::string& description) override;
+  std::unique_ptr<sup::oac_tree::IUserInputFuture> RequestUserInput(
+    const sup::oac_tree::UserInputRequest& request) override;
+  void Message(const std::string& message) override;
+  void Log(int severity, const std::string& message) override;
+
+private:
+  sup::oac_tree::UserInterface& m_ui;
+};
+}  // unnamed namespace
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string ParallelFor::Type = "ParallelFor";
+
+ParallelFor::ParallelFor()
+  : DecoratorInstruction(ParallelFor::Type)
+  , m_workers{}
+  , m_n_active_workers{0}
+  , m_active_workers_mutex{}
+  , m_active_workers_cv{}
+  , m_array{}
+  , m_element_var_name{}
+  , m_n_elements{0}
+  , m_next_element{0}
+  , m_stop{false}
+  , m_n_success{0}
+  , m_n_failure{0}
+  , m_success_th{0}
+  , m_failure_th{0}
+  , m_timing_accuracy_ns{}
+{
+  AddAttributeDefinition(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME)
+    .SetCategory(AttributeCategory::kVariableName).SetMandatory();
+  AddAttributeDefinition(Constants::MAX_CONCURRENCY_ATTRIBUTE_NAME,
+                         sup::dto::UnsignedInteger32Type);
+  AddAttributeDefinition(Constants::SUCCESS_THRESHOLD_ATTRIBUTE_NAME,
+                         sup::dto::UnsignedInteger32Type);
+  AddAttributeDefinition(Constants::FAILURE_THRESHOLD_ATTRIBUTE_NAME,
+                         sup::dto::UnsignedInteger32Type);
+}
+
+ParallelFor::~ParallelFor()
+{
+  StopWorkers();
+}
+
+void ParallelFor::SetupImpl(const Procedure& proc)
+{
+  StopWorkers();
+  SetupChild(proc);
+  if (auto threaded = InstructionHelper::FindThreadedInstruction(*GetChild()))
+  {
+    std::string error_message = InstructionSetupExceptionProlog(*this) +
+      "child instruction tree contains instruction of type [" + threaded->GetType() +
+      "], which would not see the element variable binding from its own threads";
+    throw InstructionSetupException(error_message);
+  }
+  m_timing_accuracy_ns = TimingAccuracyNs(proc);
+  auto max_concurrency = DEFAULT_MAX_CONCURRENCY;
+  if (HasAttribute(Constants::MAX_CONCURRENCY_ATTRIBUTE_NAME))
+  {
+    auto parsed = utils::ParseAttributeString(
+      sup::dto::UnsignedInteger32Type, GetAttributeString(Constants::MAX_CONCURRENCY_ATTRIBUTE_NAME));
+    if (!parsed.first || parsed.second.As<sup::dto::uint32>() == 0)
+    {
+      std::string error_message = InstructionSetupExceptionProlog(*this) +
+        "attribute [" + Constants::MAX_CONCURRENCY_ATTRIBUTE_NAME +
+        "] must be a strictly positive integer";
+      throw InstructionSetupException(error_message);
+    }
+    max_concurrency = parsed.second.As<sup::dto::uint32>();
+  }
+  m_workers.clear();
+  for (sup::dto::uint32 idx = 0; idx < max_concurrency; ++idx)
+  {
+    auto worker = InstructionHelper::CloneInstruction(GetChild());
+    if (!worker)
+    {
+      std::string error_message = InstructionSetupExceptionProlog(*this) +
+        "could not copy child instruction of type [" + GetChild()->GetType() + "]";
+      throw InstructionSetupException(error_message);
+    }
+    LinkCancellationToken(*worker);
+    worker->Setup(proc);
+    m_workers.push_back(std::move(worker));
+  }
+}
+
+bool ParallelFor::InitHook(UserInterface& ui, Workspace& ws)
+{
+  StopWorkers();
+  auto array_var_name = GetAttributeString(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME);
+  m_array = ws.GetSnapshot(array_var_name);
+  if (!m_array)
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "could not read array variable with name [" + array_var_name + "] from workspace";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  if (!sup::dto::IsArrayValue(*m_array))
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "ParallelFor instruction expects an array but variable with name [" + array_var_name +
+      "] is not one.";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  m_n_elements = static_cast<sup::dto::uint32>(m_array->NumberOfElements());
+  if (!InitThresholds(ui, ws))
+  {
+    return false;
+  }
+  return m_n_elements == 0 || StartWorkers(ui, ws);
+}
+
+ExecutionStatus ParallelFor::ExecuteSingleImpl(UserInterface&, Workspace&)
+{
+  auto status = CalculateStatus();
+  if (IsFinishedStatus(status))
+  {
+    StopWorkers();
+  }
+  return status;
+}
+
+void ParallelFor::HaltImpl()
+{
+  m_stop = true;
+  for (auto& worker : m_workers)
+  {
+    worker->Halt();
+  }
+  HaltChild();
+}
+
+void ParallelFor::ResetHook(UserInterface& ui)
+{
+  StopWorkers();
+  WorkerUserInterface worker_ui{ui};
+  for (auto& worker : m_workers)
+  {
+    worker->Reset(worker_ui);
+  }
+  m_array.reset();
+  ResetChild(ui);
+}
+
+bool ParallelFor::StartWorkers(UserInterface& ui, Workspace& ws)
+{
+  m_element_var_name = GetAttributeString(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME);
+  sup::dto::AnyValue element_val;
+  if (!GetAttributeValue(Constants::ELEMENT_VARIABLE_NAME_ATTRIBUTE_NAME, ws, ui, element_val))
+  {
+    return false;
+  }
+  if (element_val.GetType() != m_array->GetType().ElementType())
+  {
+    std::string warning_message =
+      InstructionWarningProlog(*this) + "The element [" + m_element_var_name +
+      "] and the elements of array [" +
+      GetAttributeString(Constants::ARRAY_VARIABLE_NAME_ATTRIBUTE_NAME) +
+      "] have to be of the same type.";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  m_next_element = 0;
+  m_n_success = 0;
+  m_n_failure = 0;
+  m_stop = false;
+  auto n_workers = std::min<std::size_t>(m_workers.size(), m_n_elements);
+  {
+    std::lock_guard<std::mutex> lk{m_active_workers_mutex};
+    m_n_active_workers = n_workers;
+  }
+  for (std::size_t idx = 0; idx < n_workers; ++idx)
+  {
+    ws.SubmitWork([this, idx, &ui, &ws]() {
+      RunWorker(idx, ui, ws);
+      OnWorkerFinished();
+    });
+  }
+  return true;
+}
+
+void ParallelFor::StopWorkers()
+{
+  std::unique_lock<std::mutex> lk{m_active_workers_mutex};
+  if (m_n_active_workers == 0)
+  {
+    return;
+  }
+  m_stop = true;
+  for (auto& worker : m_workers)
+  {
+    worker->Halt();
+  }
+  m_active_workers_cv.wait(lk, [this]() { return m_n_active_workers == 0; });
+}
+
+void ParallelFor::RunWorker(std::size_t worker_idx, UserInterface& ui, Workspace& ws)
+{
+  WorkerUserInterface worker_ui{ui};
+  auto& worker = *m_workers[worker_idx];
+  while (!m_stop)
+  {
+    auto element_idx = m_next_element++;
+    if (element_idx >= m_n_elements)
+    {
+      break;
+    }
+    auto status = ExecutionStatus::FAILURE;
+    try
+    {
+      worker.Reset(worker_ui);
+      if (ws.BindLocalValue(m_element_var_name, (*m_array)[element_idx]))
+      {
+        while (!m_stop && NeedsExecute(worker.GetStatus()))
+        {
+          worker.ExecuteSingle(worker_ui, ws);
+          if (worker.GetStatus() == ExecutionStatus::RUNNING)
+          {
+            // Halting the worker cancels its token, which releases this wait immediately:
+            auto deadline = std::chrono::steady_clock::now() +
+                            std::chrono::nanoseconds(m_timing_accuracy_ns);
+            (void)worker.GetCancellationToken().WaitUntil(deadline);
+          }
+        }
+        status = worker.GetStatus();
+      }
+    }
+    catch (const std::exception& e)
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "exception thrown while processing element [" + std::to_string(element_idx) + "]: " +
+        e.what();
+      LogWarning(ui, warning_message);
+    }
+    ws.UnbindLocalValues();
+    if (m_stop)
+    {
+      break;
+    }
+    if (status == ExecutionStatus::SUCCESS)
+    {
+      ++m_n_success;
+    }
+    else
+    {
+      ++m_n_failure;
+    }
+    // Let the runner pick up the new status without waiting for its tick timeout:
+    ws.RequestTick();
+  }
+}
+
+void ParallelFor::OnWorkerFinished()
+{
+  std::lock_guard<std::mutex> lk{m_active_workers_mutex};
+  --m_n_active_workers;
+  m_active_workers_cv.notify_all();
+}
+
+bool ParallelFor::InitThresholds(UserInterface& ui, Workspace& ws)
+{
+  auto N = m_n_elements;
+  return InstructionHelper::InitThresholds(*this, N, ui, ws, m_success_th, m_failure_th);
+}
+
+ExecutionStatus ParallelFor::CalculateStatus() const
+{
+  if (m_n_success >= m_success_th)
+  {
+    return ExecutionStatus::SUCCESS;
+  }
+  if (m_n_failure >= m_failure_th)
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  return ExecutionStatus::RUNNING;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+namespace
+{
+using namespace sup::oac_tree;
+
+WorkerUserInterface::WorkerUserInterface(UserInterface& ui)
+  : m_ui{ui}
+{}
+
+WorkerUserInterface::~WorkerUserInterface() = default;
+
+void WorkerUserInterface::UpdateInstructionStatus(const Instruction*)
+{}
+
+void WorkerUserInterface::VariableUpdated(const std::string& name, const sup::dto::AnyValue& value,
+                                          bool connected)
+{
+  m_ui.VariableUpdated(name, value, connected);
+}
+
+bool WorkerUserInterface::PutValue(const sup::dto::AnyValue& value, const std::string& description)
+{
+  return m_ui.PutValue(value, description);
+}
+
+std::unique_ptr<IUserInputFuture> WorkerUserInterface::RequestUserInput(
+  const UserInputRequest& request)
+{
+  return m_ui.RequestUserInput(request);
+}
+
+void WorkerUserInterface::Message(const std::string& message)
+{
+  m_ui.Message(message);
+}
+
+void WorkerUserInterface::Log(int severity, const std::string& message)
+{
+  m_ui.Log(severity, message);
+}
+
+}  // unnamed namespace
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PARALLEL_FOR_H_
+#define SUP_OAC_TREE_PARALLEL_FOR_H_
+
+#include <sup/oac-tree/decorator_instruction.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Instruction decorator that applies a child instruction concurrently to the elements of
+ * an array.
+ *
+ * @details At most 'maxConcurrency' workers process the elements of the array on the shared worker
+ * threads of the workspace (see Workspace::SubmitWork). Each worker runs its own copy of the child
+ * instruction tree to completion for one element at a time, with the element variable bound to the
+ * current element for that worker only (see Workspace::BindLocalValue). The success and failure
+ * thresholds behave as in ParallelSequence, where the number of elements plays the role of the
+ * number of child instructions.
+ *
+ * @note The copies of the child instruction tree do not report their status to the user
+ * interface.
+ * @note Since element bindings are not visible to other threads, child instruction trees that
+ * execute instructions on threads of their own (ParallelSequence, Async and ParallelFor) are
+ * rejected during setup.
+ */
+class ParallelFor : public DecoratorInstruction
+{
+public:
+  ParallelFor();
+
+  ~ParallelFor() override;
+
+  static const std::string Type;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+
+  bool InitHook(UserInterface& ui, Workspace& ws) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  void HaltImpl() override;
+
+  void ResetHook(UserInterface& ui) override;
+
+  /**
+   * @brief Check the array and element variables and submit the workers to the workspace.
+   *
+   * @return true on success.
+   */
+  bool StartWorkers(UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Stop handing out elements, halt the running copies of the child instruction and wait
+   * for the workers to finish.
+   */
+  void StopWorkers();
+
+  /**
+   * @brief Body of a worker task.
+   */
+  void RunWorker(std::size_t worker_idx, UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Signal that a worker task has returned.
+   */
+  void OnWorkerFinished();
+
+  bool InitThresholds(UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Calculate this instruction's status from the number of finished elements.
+   */
+  ExecutionStatus CalculateStatus() const;
+
+  /**
+   * @brief Copies of the child instruction tree, one per worker.
+   */
+  std::vector<std::unique_ptr<Instruction>> m_workers;
+  std::size_t m_n_active_workers;
+  std::mutex m_active_workers_mutex;
+  std::condition_variable m_active_workers_cv;
+
+  /**
+   * @brief Read-only snapshot of the array, shared by all workers during execution.
+   */
+  std::shared_ptr<const sup::dto::AnyValue> m_array;
+  std::string m_element_var_name;
+  sup::dto::uint32 m_n_elements;
+  std::atomic<sup::dto::uint32> m_next_element;
+  std::atomic<bool> m_stop;
+  std::atomic<sup::dto::uint32> m_n_success;
+  std::atomic<sup::dto::uint32> m_n_failure;
+  sup::dto::uint32 m_success_th;
+  sup::dto::uint32 m_failure_th;
+  sup::dto::int64 m_timing_accuracy_ns;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PARALLEL_FOR_H_
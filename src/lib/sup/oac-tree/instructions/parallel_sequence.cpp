@@ -22,10 +22,27 @@
 
 #include "parallel_sequence.h"
 
+#include "instruction_helper.h"
+
 #include <sup/oac-tree/constants.h>
 #include <sup/oac-tree/exceptions.h>
 #include <sup/oac-tree/generic_utils.h>
 
+namespace
+{
+const std::string EXECUTION_MODE_THREADS = "threads";
+const std::string EXECUTION_MODE_AUTO = "auto";
+const std::string EXECUTION_MODE_ADAPTIVE = "adaptive";
+
+// Execution steps that take longer than this are moved to a separate thread in adaptive mode.
+const sup::dto::int64 INLINE_EXECUTION_THRESHOLD_NS = 100000;
+
+// Number of fast execution steps in a separate thread before moving to inline execution.
+const sup::dto::uint64 INLINE_EXECUTION_MIN_COUNT = 3;
+
+bool PreferInlineExecution(const sup::oac_tree::AsyncWrapper& wrapper);
+}  // unnamed namespace
+
 namespace sup
 {
 namespace oac_tree
@@ -34,17 +51,54 @@ const std::string ParallelSequence::Type = "ParallelSequence";
 
 ParallelSequence::ParallelSequence()
   : CompoundInstruction(ParallelSequence::Type)
+  , m_ready{}
+  , m_finished{}
+  , m_finished_mutex{}
+  , m_execution_times{}
+  , m_wrappers{}
+  , m_n_success{0}
+  , m_n_failure{0}
   , m_success_th{0}
   , m_failure_th{0}
+  , m_execution_mode{ExecutionMode::kAuto}
 {
   AddAttributeDefinition(Constants::SUCCESS_THRESHOLD_ATTRIBUTE_NAME,
                          sup::dto::UnsignedInteger32Type);
   AddAttributeDefinition(Constants::FAILURE_THRESHOLD_ATTRIBUTE_NAME,
                          sup::dto::UnsignedInteger32Type);
+  AddAttributeDefinition(Constants::EXECUTION_MODE_ATTRIBUTE_NAME, sup::dto::StringType);
 }
 
 ParallelSequence::~ParallelSequence() = default;
 
+void ParallelSequence::SetupImpl(const Procedure& proc)
+{
+  SetupChildren(proc);
+  // Statistics of earlier activations are only reset here:
+  m_execution_times.clear();
+  m_execution_mode = ExecutionMode::kAuto;
+  if (!HasAttribute(Constants::EXECUTION_MODE_ATTRIBUTE_NAME))
+  {
+    return;
+  }
+  auto mode = GetAttributeString(Constants::EXECUTION_MODE_ATTRIBUTE_NAME);
+  if (mode == EXECUTION_MODE_THREADS)
+  {
+    m_execution_mode = ExecutionMode::kThreads;
+  }
+  else if (mode == EXECUTION_MODE_ADAPTIVE)
+  {
+    m_execution_mode = ExecutionMode::kAdaptive;
+  }
+  else if (mode != EXECUTION_MODE_AUTO)
+  {
+    std::string error_message = InstructionSetupExceptionProlog(*this) +
+      "unknown execution mode [" + mode + "], expected one of [" + EXECUTION_MODE_THREADS + ", " +
+      EXECUTION_MODE_AUTO + ", " + EXECUTION_MODE_ADAPTIVE + "]";
+    throw InstructionSetupException(error_message);
+  }
+}
+
 bool ParallelSequence::InitHook(UserInterface& ui, Workspace& ws)
 {
   InitWrappers();
@@ -53,13 +107,16 @@ bool ParallelSequence::InitHook(UserInterface& ui, Workspace& ws)
 
 ExecutionStatus ParallelSequence::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  for (auto &wrapper : m_wrappers)
+  std::vector<std::size_t> to_tick;
+  std::swap(to_tick, m_ready);
   {
-    auto wrapper_status = wrapper.GetStatus();
-    if (NeedsExecute(wrapper_status))
-    {
-      wrapper.Tick(ui, ws);
-    }
+    std::lock_guard<std::mutex> lk(m_finished_mutex);
+    to_tick.insert(to_tick.end(), m_finished.begin(), m_finished.end());
+    m_finished.clear();
+  }
+  for (auto idx : to_tick)
+  {
+    TickWrapper(idx, ui, ws);
   }
   auto status = CalculateCompoundStatus();
   if (IsFinishedStatus(status))
@@ -79,6 +136,11 @@ void ParallelSequence::ResetHook(UserInterface& ui)
   }
   // wait for child threads to terminate
   m_wrappers.clear();
+  m_ready.clear();
+  {
+    std::lock_guard<std::mutex> lk(m_finished_mutex);
+    m_finished.clear();
+  }
   // call reset on child instructions
   ResetChildren(ui);
 }
@@ -90,8 +152,9 @@ std::vector<const Instruction*> ParallelSequence::NextInstructionsImpl() const
     return ChildInstructions();
   }
   std::vector<const Instruction*> result;
-  for (auto& wrapper : m_wrappers)
+  for (auto idx : m_ready)
   {
+    const auto& wrapper = m_wrappers[idx];
     if (ReadyForExecute(wrapper.GetStatus()))
     {
       result.push_back(wrapper.GetInstruction());
@@ -100,74 +163,118 @@ std::vector<const Instruction*> ParallelSequence::NextInstructionsImpl() const
   return result;
 }
 
+bool ParallelSequence::IsNonBlockingImpl() const
+{
+  return true;
+}
+
+bool ParallelSequence::CompletesSynchronouslyImpl() const
+{
+  // Blocking children run on other threads, which this instruction only polls.
+  return false;
+}
+
 ExecutionStatus ParallelSequence::CalculateCompoundStatus() const
 {
-  int n_success = 0;
-  int n_failure = 0;
-  bool child_not_finished_present = false;
-  for (const auto &wrapper : m_wrappers)
-  {
-    auto wrapper_status = wrapper.GetStatus();
-    if (wrapper_status == ExecutionStatus::SUCCESS)
-    {
-      n_success++;
-    }
-    if (wrapper_status == ExecutionStatus::FAILURE)
-    {
-      n_failure++;
-    }
-    if (wrapper_status == ExecutionStatus::NOT_FINISHED)
-    {
-      child_not_finished_present = true;
-    }
-  }
-  if (n_success >= m_success_th)
+  if (m_n_success >= m_success_th)
   {
     return ExecutionStatus::SUCCESS;
   }
-  if (n_failure >= m_failure_th)
+  if (m_n_failure >= m_failure_th)
   {
     return ExecutionStatus::FAILURE;
   }
-  return child_not_finished_present ? ExecutionStatus::NOT_FINISHED : ExecutionStatus::RUNNING;
+  for (auto idx : m_ready)
+  {
+    if (m_wrappers[idx].GetStatus() == ExecutionStatus::NOT_FINISHED)
+    {
+      return ExecutionStatus::NOT_FINISHED;
+    }
+  }
+  return ExecutionStatus::RUNNING;
 }
 
 void ParallelSequence::InitWrappers()
 {
   m_wrappers.clear();
-  for (auto child : ChildInstructions())
+  m_ready.clear();
   {
-    m_wrappers.emplace_back(child);
+    std::lock_guard<std::mutex> lk(m_finished_mutex);
+    m_finished.clear();
   }
-}
-
-bool ParallelSequence::InitThresholds(UserInterface& ui, Workspace& ws)
-{
-  auto N = static_cast<sup::dto::uint32>(ChildInstructions().size());
-  m_success_th = N;
-  // Literal attributes can't fail:
-  if (!GetAttributeValueAs(Constants::SUCCESS_THRESHOLD_ATTRIBUTE_NAME, ws, ui, m_success_th))
+  m_n_success = 0;
+  m_n_failure = 0;
+  auto children = Children();
+  while (m_execution_times.size() < children.size())
   {
-    return false;
+    m_execution_times.push_back(std::make_shared<AsyncWrapper::ExecutionTimes>());
   }
-  m_success_th = std::min(N, m_success_th);
-  m_failure_th = 1;
-  if (!GetAttributeValueAs(Constants::FAILURE_THRESHOLD_ATTRIBUTE_NAME, ws, ui, m_failure_th))
+  for (auto child : children)
   {
-    return false;
+    auto idx = m_wrappers.size();
+    m_wrappers.emplace_back(child, [this, idx]() { OnThreadFinished(idx); },
+                            m_execution_times[idx]);
+    m_wrappers.back().SetInline(m_execution_mode != ExecutionMode::kThreads
+                                && child->IsNonBlocking());
+    m_ready.push_back(idx);
   }
-  m_failure_th = std::min(N, m_failure_th);
-  if (HasAttribute(Constants::SUCCESS_THRESHOLD_ATTRIBUTE_NAME))
+}
+
+bool ParallelSequence::InitThresholds(UserInterface& ui, Workspace& ws)
+{
+  auto N = static_cast<sup::dto::uint32>(Children().size());
+  return InstructionHelper::InitThresholds(*this, N, ui, ws, m_success_th, m_failure_th);
+}
+
+void ParallelSequence::TickWrapper(std::size_t idx, UserInterface& ui, Workspace& ws)
+{
+  auto& wrapper = m_wrappers[idx];
+  if (m_execution_mode == ExecutionMode::kAdaptive)
   {
-    m_failure_th = std::min(m_failure_th, N - m_success_th + 1);
+    wrapper.SetInline(PreferInlineExecution(wrapper));
   }
-  else if (HasAttribute(Constants::FAILURE_THRESHOLD_ATTRIBUTE_NAME))
+  auto launched = wrapper.Tick(ui, ws);
+  switch (wrapper.GetStatus())
   {
-    m_success_th = N + 1 - m_failure_th;
+  case ExecutionStatus::SUCCESS:
+    ++m_n_success;
+    break;
+  case ExecutionStatus::FAILURE:
+    ++m_n_failure;
+    break;
+  case ExecutionStatus::RUNNING:
+    // A thread that reported to be finished may not have released its shared state yet. In that
+    // case, the wrapper did not launch a new thread and needs to be ticked again.
+    if (!launched)
+    {
+      m_ready.push_back(idx);
+    }
+    break;
+  default:
+    m_ready.push_back(idx);
+    break;
   }
-  return true;
+}
+
+void ParallelSequence::OnThreadFinished(std::size_t idx)
+{
+  std::lock_guard<std::mutex> lk(m_finished_mutex);
+  m_finished.push_back(idx);
 }
 
 }  // namespace oac_tree
 
 }  // namespace sup
+
+namespace
+{
+bool PreferInlineExecution(const sup::oac_tree::AsyncWrapper& wrapper)
+{
+  if (wrapper.GetMaxExecutionTimeNs() > INLINE_EXECUTION_THRESHOLD_NS)
+  {
+    return false;
+  }
+  return wrapper.GetInstruction()->IsNonBlocking()
+         || wrapper.GetExecutionCount() >= INLINE_EXECUTION_MIN_COUNT;
+}
+}  // unnamed namespace
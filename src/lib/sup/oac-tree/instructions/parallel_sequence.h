@@ -26,6 +26,8 @@
 #include "async_wrapper.h"
 #include <sup/oac-tree/compound_instruction.h>
 
+#include <mutex>
+
 namespace sup
 {
 namespace oac_tree
@@ -38,6 +40,14 @@ namespace oac_tree
  * than or equal to the success threshold). It fails when the failure threshold
  * is reached or the success threshold can no longer be reached. It returns
  * RUNNING otherwise.
+ *
+ * The optional 'executionMode' attribute selects which child instructions are executed in a
+ * separate thread:
+ * - "threads": all child instructions;
+ * - "auto" (default): only child instructions that are not marked as non-blocking (see
+ *   Instruction::IsNonBlocking). The others are executed inline during the tick;
+ * - "adaptive": as "auto", but child instructions that turn out to be slow are moved to a
+ *   separate thread and child instructions that are consistently fast are executed inline.
  */
 class ParallelSequence : public CompoundInstruction
 {
@@ -49,6 +59,15 @@ public:
   static const std::string Type;
 
 private:
+  enum class ExecutionMode
+  {
+    kThreads,
+    kAuto,
+    kAdaptive
+  };
+
+  void SetupImpl(const Procedure& proc) override;
+
   bool InitHook(UserInterface& ui, Workspace& ws) override;
 
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
@@ -57,6 +76,14 @@ private:
 
   std::vector<const Instruction*> NextInstructionsImpl() const override;
 
+  /**
+   * @brief ParallelSequence itself never blocks: blocking child instructions run in separate
+   * threads.
+   */
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
+
   /**
    * @brief Calculate this instruction's status from the status of its child instructions.
    */
@@ -70,10 +97,52 @@ private:
 
   bool InitThresholds(UserInterface& ui, Workspace& ws);
 
+  /**
+   * @brief Tick the wrapper with the given index and account for its new status.
+   */
+  void TickWrapper(std::size_t idx, UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Called from a child's execution thread when it finished.
+   */
+  void OnThreadFinished(std::size_t idx);
+
+  /**
+   * @brief Indices of wrappers that need to be ticked in the next tick, since they are not
+   * running in a separate thread.
+   */
+  std::vector<std::size_t> m_ready;
+
+  /**
+   * @brief Indices of wrappers whose execution thread finished since the last tick.
+   *
+   * @note Wrappers that are running are not ticked until their thread reports here, so a tick only
+   * costs in proportion to the number of branches that changed.
+   */
+  std::vector<std::size_t> m_finished;
+  std::mutex m_finished_mutex;
+
+  /**
+   * @brief Execution statistics of each child instruction, used by the adaptive execution mode.
+   *
+   * @note The wrappers are recreated on each activation, so the statistics are kept here, indexed
+   * by child, and only reset during setup.
+   */
+  std::vector<std::shared_ptr<AsyncWrapper::ExecutionTimes>> m_execution_times;
+
+  /**
+   * @note Declared after the members used by OnThreadFinished, so the wrappers (and their
+   * execution threads) are destroyed first.
+   */
   std::vector<AsyncWrapper> m_wrappers;
 
+  sup::dto::uint32 m_n_success;
+  sup::dto::uint32 m_n_failure;
+
   sup::dto::uint32 m_success_th;
   sup::dto::uint32 m_failure_th;
+
+  ExecutionMode m_execution_mode;
 };
 
 }  // namespace oac_tree
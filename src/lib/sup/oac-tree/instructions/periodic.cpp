@@ -0,0 +1,261 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "periodic.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <algorithm>
+
+namespace
+{
+const std::string OVERRUN_POLICY_SKIP = "skip";
+const std::string OVERRUN_POLICY_CATCH_UP = "catchUp";
+const std::string OVERRUN_POLICY_FAIL = "fail";
+
+const std::string PERIODIC_STATISTICS_TYPE = "sup::periodicStatisticsType/v1.0";
+const std::string ITERATIONS_FIELD = "iterations";
+const std::string OVERRUNS_FIELD = "overruns";
+const std::string SKIPPED_FIELD = "skipped";
+const std::string LAST_JITTER_FIELD = "last_jitter_ns";
+const std::string MAX_JITTER_FIELD = "max_jitter_ns";
+const std::string MEAN_JITTER_FIELD = "mean_jitter_ns";
+}  // unnamed namespace
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string Periodic::Type = "Periodic";
+
+Periodic::Periodic()
+  : DecoratorInstruction(Periodic::Type)
+  , m_overrun_policy{OverrunPolicy::kSkip}
+  , m_blocking{false}
+  , m_max_count{-1}
+  , m_period{0}
+  , m_next_deadline{}
+  , m_stats{}
+{
+  AddAttributeDefinition(Constants::PERIOD_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
+    .SetCategory(AttributeCategory::kBoth).SetMandatory();
+  AddAttributeDefinition(Constants::PHASE_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
+    .SetCategory(AttributeCategory::kBoth);
+  AddAttributeDefinition(Constants::MAX_COUNT_ATTRIBUTE_NAME, sup::dto::SignedInteger32Type)
+    .SetCategory(AttributeCategory::kBoth);
+  AddAttributeDefinition(Constants::BLOCKING_ATTRIBUTE_NAME, sup::dto::BooleanType)
+    .SetCategory(AttributeCategory::kBoth);
+  AddAttributeDefinition(Constants::OVERRUN_POLICY_ATTRIBUTE_NAME);
+  AddAttributeDefinition(Constants::STATISTICS_VARIABLE_NAME_ATTRIBUTE_NAME);
+}
+
+Periodic::~Periodic() = default;
+
+void Periodic::SetupImpl(const Procedure& proc)
+{
+  SetupChild(proc);
+  m_overrun_policy = OverrunPolicy::kSkip;
+  if (!HasAttribute(Constants::OVERRUN_POLICY_ATTRIBUTE_NAME))
+  {
+    return;
+  }
+  auto policy_str = GetAttributeString(Constants::OVERRUN_POLICY_ATTRIBUTE_NAME);
+  if (policy_str == OVERRUN_POLICY_SKIP)
+  {
+    m_overrun_policy = OverrunPolicy::kSkip;
+  }
+  else if (policy_str == OVERRUN_POLICY_CATCH_UP)
+  {
+    m_overrun_policy = OverrunPolicy::kCatchUp;
+  }
+  else if (policy_str == OVERRUN_POLICY_FAIL)
+  {
+    m_overrun_policy = OverrunPolicy::kFail;
+  }
+  else
+  {
+    std::string error_message = InstructionSetupExceptionProlog(*this) +
+      "unknown overrun policy [" + policy_str + "], expected one of [" + OVERRUN_POLICY_SKIP +
+      ", " + OVERRUN_POLICY_CATCH_UP + ", " + OVERRUN_POLICY_FAIL + "]";
+    throw InstructionSetupException(error_message);
+  }
+}
+
+bool Periodic::InitHook(UserInterface& ui, Workspace& ws)
+{
+  m_blocking = false;
+  m_max_count = -1;
+  m_stats = {};
+  if (!GetAttributeValueAs(Constants::BLOCKING_ATTRIBUTE_NAME, ws, ui, m_blocking)
+      || !GetAttributeValueAs(Constants::MAX_COUNT_ATTRIBUTE_NAME, ws, ui, m_max_count))
+  {
+    return false;
+  }
+  sup::dto::int64 period_ns{0};
+  sup::dto::int64 phase_ns{0};
+  if (!instruction_utils::GetVariableTimeoutAttribute(
+            *this, ui, ws, Constants::PERIOD_SEC_ATTRIBUTE_NAME, period_ns)
+      || !instruction_utils::GetVariableTimeoutAttribute(
+            *this, ui, ws, Constants::PHASE_SEC_ATTRIBUTE_NAME, phase_ns))
+  {
+    return false;
+  }
+  if (period_ns <= 0)
+  {
+    std::string warning_message = InstructionWarningProlog(*this) + "attribute [" +
+      Constants::PERIOD_SEC_ATTRIBUTE_NAME + "] needs to be strictly positive";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  m_period = std::chrono::nanoseconds(period_ns);
+  m_next_deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(phase_ns);
+  return true;
+}
+
+ExecutionStatus Periodic::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  if (m_max_count == 0)
+  {
+    return ExecutionStatus::SUCCESS;
+  }
+  if (GetChildStatus() == ExecutionStatus::NOT_STARTED)
+  {
+    if (m_blocking)
+    {
+      (void)GetCancellationToken().WaitUntilPrecise(m_next_deadline);
+    }
+    if (GetCancellationToken().IsCancelled())
+    {
+      return ExecutionStatus::FAILURE;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now < m_next_deadline)
+    {
+      return ExecutionStatus::RUNNING;
+    }
+    RecordJitter(now);
+  }
+  ExecuteChild(ui, ws);
+  auto child_status = GetChildStatus();
+  if (child_status != ExecutionStatus::SUCCESS)
+  {
+    return child_status;
+  }
+  ++m_stats.iterations;
+  const bool on_time = ScheduleNextActivation();
+  if (!PublishStatistics(ui, ws))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  if (!on_time)
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "child instruction finished after the next deadline";
+    LogWarning(ui, warning_message);
+    return ExecutionStatus::FAILURE;
+  }
+  if (m_max_count > 0 && m_stats.iterations >= static_cast<sup::dto::uint64>(m_max_count))
+  {
+    return ExecutionStatus::SUCCESS;
+  }
+  ResetChild(ui);
+  if (m_blocking || std::chrono::steady_clock::now() >= m_next_deadline)
+  {
+    return ExecutionStatus::NOT_FINISHED;
+  }
+  return ExecutionStatus::RUNNING;
+}
+
+bool Periodic::IsNonBlockingImpl() const
+{
+  // The blocking attribute may refer to a variable, so only a literal 'false' allows inline
+  // execution.
+  if (HasAttribute(Constants::BLOCKING_ATTRIBUTE_NAME)
+      && GetAttributeString(Constants::BLOCKING_ATTRIBUTE_NAME) != "false")
+  {
+    return false;
+  }
+  return IsChildNonBlocking();
+}
+
+void Periodic::RecordJitter(std::chrono::steady_clock::time_point activation)
+{
+  auto jitter = std::chrono::duration_cast<std::chrono::nanoseconds>(activation - m_next_deadline);
+  m_stats.last_jitter_ns = static_cast<sup::dto::uint64>(jitter.count());
+  m_stats.max_jitter_ns = std::max(m_stats.max_jitter_ns, m_stats.last_jitter_ns);
+  m_stats.total_jitter_ns += m_stats.last_jitter_ns;
+}
+
+bool Periodic::ScheduleNextActivation()
+{
+  m_next_deadline += m_period;
+  auto now = std::chrono::steady_clock::now();
+  if (now < m_next_deadline)
+  {
+    return true;
+  }
+  ++m_stats.overruns;
+  switch (m_overrun_policy)
+  {
+  case OverrunPolicy::kSkip:
+  {
+    // Continue with the first deadline in the future, staying on the original grid:
+    auto n_missed = (now - m_next_deadline) / m_period + 1;
+    m_next_deadline += n_missed * m_period;
+    m_stats.skipped += static_cast<sup::dto::uint64>(n_missed);
+    return true;
+  }
+  case OverrunPolicy::kCatchUp:
+    return true;
+  case OverrunPolicy::kFail:
+    return false;
+  }
+  return false;
+}
+
+bool Periodic::PublishStatistics(UserInterface& ui, Workspace& ws) const
+{
+  if (!HasAttribute(Constants::STATISTICS_VARIABLE_NAME_ATTRIBUTE_NAME))
+  {
+    return true;
+  }
+  const sup::dto::uint64 mean_jitter_ns =
+    m_stats.iterations > 0 ? m_stats.total_jitter_ns / m_stats.iterations : 0;
+  sup::dto::AnyValue stats = {{
+    { ITERATIONS_FIELD, { sup::dto::UnsignedInteger64Type, m_stats.iterations }},
+    { OVERRUNS_FIELD, { sup::dto::UnsignedInteger64Type, m_stats.overruns }},
+    { SKIPPED_FIELD, { sup::dto::UnsignedInteger64Type, m_stats.skipped }},
+    { LAST_JITTER_FIELD, { sup::dto::UnsignedInteger64Type, m_stats.last_jitter_ns }},
+    { MAX_JITTER_FIELD, { sup::dto::UnsignedInteger64Type, m_stats.max_jitter_ns }},
+    { MEAN_JITTER_FIELD, { sup::dto::UnsignedInteger64Type, mean_jitter_ns }}
+  }, PERIODIC_STATISTICS_TYPE };
+  return SetValueFromAttributeName(*this, ws, ui,
+                                   Constants::STATISTICS_VARIABLE_NAME_ATTRIBUTE_NAME, stats);
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PERIODIC_H_
+#define SUP_OAC_TREE_PERIODIC_H_
+
+#include <sup/oac-tree/decorator_instruction.h>
+
+#include <chrono>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Decorator that executes its child at fixed, absolute steady clock deadlines.
+ *
+ * @details The n-th activation of the child is scheduled at start + phase + n * period, where
+ * start is the time the decorator was started. Since the deadlines do not depend on the time the
+ * child needed, the schedule does not drift. When the child finishes after the next deadline
+ * (overrun), the 'overrunPolicy' attribute decides what happens: 'skip' (default) continues with
+ * the first deadline in the future, 'catchUp' executes the missed activations immediately and
+ * 'fail' makes the decorator fail.
+ *
+ * The decorator fails when the child fails and succeeds after 'maxCount' successful activations
+ * (runs until failure or halt when 'maxCount' is absent or negative). A blocking decorator sleeps
+ * on its cancellation token until the next deadline, while a non-blocking one returns RUNNING.
+ * Since the non-blocking decorator does not request a tick at the deadline, its jitter is bounded
+ * by the tick timeout of the runner instead of the accuracy of the sleep.
+ *
+ * When the 'statsVar' attribute is present, the activation statistics (number of iterations,
+ * overruns, skipped activations and the last, maximum and mean jitter in nanoseconds) are written
+ * to that variable after each activation, making them available to the job's user interface.
+ */
+class Periodic : public DecoratorInstruction
+{
+public:
+  Periodic();
+
+  ~Periodic() override;
+
+  static const std::string Type;
+
+  enum class OverrunPolicy
+  {
+    kSkip,
+    kCatchUp,
+    kFail
+  };
+
+private:
+  struct Statistics
+  {
+    sup::dto::uint64 iterations;
+    sup::dto::uint64 overruns;
+    sup::dto::uint64 skipped;
+    sup::dto::uint64 last_jitter_ns;
+    sup::dto::uint64 max_jitter_ns;
+    sup::dto::uint64 total_jitter_ns;
+  };
+
+  void SetupImpl(const Procedure& proc) override;
+
+  bool InitHook(UserInterface& ui, Workspace& ws) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  /**
+   * @brief Record the delay between the deadline and the actual activation.
+   */
+  void RecordJitter(std::chrono::steady_clock::time_point activation);
+
+  /**
+   * @brief Advance the deadline by one period and apply the overrun policy if it already passed.
+   *
+   * @return false when an overrun occurred with the 'fail' policy.
+   */
+  bool ScheduleNextActivation();
+
+  bool PublishStatistics(UserInterface& ui, Workspace& ws) const;
+
+  OverrunPolicy m_overrun_policy;
+  bool m_blocking;
+  sup::dto::int32 m_max_count;
+  std::chrono::nanoseconds m_period;
+  std::chrono::steady_clock::time_point m_next_deadline;
+  Statistics m_stats;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PERIODIC_H_
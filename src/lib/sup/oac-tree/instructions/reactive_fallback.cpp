@@ -22,6 +22,8 @@
 
 #include "reactive_fallback.h"
 
+#include <algorithm>
+
 namespace sup
 {
 namespace oac_tree
@@ -30,14 +32,16 @@ const std::string ReactiveFallback::Type = "ReactiveFallback";
 
 ReactiveFallback::ReactiveFallback()
   : CompoundInstruction(ReactiveFallback::Type)
+  , m_touched_end{0}
 {}
 
 ReactiveFallback::~ReactiveFallback() = default;
 
 ExecutionStatus ReactiveFallback::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  for (auto instruction : ChildInstructions())
+  for (std::size_t idx = 0; idx < NumberOfChildren(); ++idx)
   {
+    auto instruction = ChildAt(idx);
     auto child_status = instruction->GetStatus();
     if (child_status == ExecutionStatus::FAILURE)
     {
@@ -48,10 +52,11 @@ ExecutionStatus ReactiveFallback::ExecuteSingleImpl(UserInterface& ui, Workspace
     if (NeedsExecute(child_status))
     {
       instruction->ExecuteSingle(ui, ws);
+      m_touched_end = std::max(m_touched_end, idx + 1);
       if (instruction->GetStatus() == ExecutionStatus::RUNNING)
       {
         // Reset all other children and immediately return RUNNING:
-        ResetOtherChildren(instruction, ui);
+        ResetOtherChildren(idx, ui);
         return ExecutionStatus::RUNNING;
       }
       break;
@@ -63,7 +68,7 @@ ExecutionStatus ReactiveFallback::ExecuteSingleImpl(UserInterface& ui, Workspace
 std::vector<const Instruction*> ReactiveFallback::NextInstructionsImpl() const
 {
   std::vector<const Instruction*> result;
-  for (auto instruction : ChildInstructions())
+  for (auto instruction : Children())
   {
     auto child_status = instruction->GetStatus();
     if (child_status == ExecutionStatus::FAILURE)
@@ -83,7 +88,7 @@ std::vector<const Instruction*> ReactiveFallback::NextInstructionsImpl() const
 
 ExecutionStatus ReactiveFallback::CalculateCompoundStatus() const
 {
-  for (auto instruction : ChildInstructions())
+  for (auto instruction : Children())
   {
     auto child_status = instruction->GetStatus();
     if (child_status == ExecutionStatus::FAILURE)
@@ -100,15 +105,23 @@ ExecutionStatus ReactiveFallback::CalculateCompoundStatus() const
   return ExecutionStatus::FAILURE;
 }
 
-void ReactiveFallback::ResetOtherChildren(const Instruction* instr, UserInterface& ui)
+void ReactiveFallback::ResetHook(UserInterface& ui)
+{
+  m_touched_end = 0;
+  ResetChildren(ui);
+}
+
+void ReactiveFallback::ResetOtherChildren(std::size_t running_idx, UserInterface& ui)
 {
-  for (auto other_instruction : ChildInstructions())
+  // Children at or beyond m_touched_end were not executed since their last reset.
+  for (std::size_t idx = 0; idx < m_touched_end; ++idx)
   {
-    if (other_instruction != instr)
+    if (idx != running_idx)
     {
-      other_instruction->Reset(ui);
+      ChildAt(idx)->Reset(ui);
     }
   }
+  m_touched_end = running_idx + 1;
 }
 
 }  // namespace oac_tree
@@ -55,13 +55,23 @@ private:
    */
   ExecutionStatus CalculateCompoundStatus() const;
 
+  void ResetHook(UserInterface& ui) override;
+
   /**
-   * @brief Reset all other child instructions.
+   * @brief Reset all other child instructions that were executed since their last reset.
    *
-   * @param instr The instruction that is running and should not be reset.
+   * @param running_idx Index of the instruction that is running and should not be reset.
    * @param ui UserInterface to handle status updates.
    */
-  void ResetOtherChildren(const Instruction* instr, UserInterface& ui);
+  void ResetOtherChildren(std::size_t running_idx, UserInterface& ui);
+
+  /**
+   * @brief One past the index of the last child that was executed since its last reset.
+   *
+   * @details Children are executed in order, so only the children before this index can have left
+   * the NOT_STARTED state and need a reset.
+   */
+  std::size_t m_touched_end;
 };
 
 }  // namespace oac_tree
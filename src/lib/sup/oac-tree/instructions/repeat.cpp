@@ -82,6 +82,11 @@ ExecutionStatus Repeat::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return CalculateStatus();
 }
 
+bool Repeat::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
 ExecutionStatus Repeat::CalculateStatus() const
 {
   auto child_status = GetChildStatus();
@@ -49,6 +49,8 @@ private:
 
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
 
+  bool IsNonBlockingImpl() const override;
+
   /**
    * @brief Calculate this instruction's status from the status of its child instruction
    * and the number of successful executions of the child instruction.
@@ -30,25 +30,24 @@ const std::string Sequence::Type = "Sequence";
 
 Sequence::Sequence()
   : CompoundInstruction(Sequence::Type)
+  , m_cursor{0}
 {}
 
 Sequence::~Sequence() = default;
 
 ExecutionStatus Sequence::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  for (auto instruction : ChildInstructions())
+  m_cursor = SkipSucceededChildren(m_cursor);
+  if (m_cursor < NumberOfChildren())
   {
-    auto child_status = instruction->GetStatus();
-    if (child_status == ExecutionStatus::SUCCESS)
-    {
-      continue;
-    }
-    // child FAILED is not taken into account here, as the Sequence should not have been ticked then.
-    if (NeedsExecute(child_status))
+    auto instruction = ChildAt(m_cursor);
+    // child FAILED is not taken into account here, as the Sequence should not have been ticked
+    // then.
+    if (NeedsExecute(instruction->GetStatus()))
     {
       instruction->ExecuteSingle(ui, ws);
-      break;
     }
+    m_cursor = SkipSucceededChildren(m_cursor);
   }
   return CalculateCompoundStatus();
 }
@@ -56,41 +55,45 @@ ExecutionStatus Sequence::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 std::vector<const Instruction*> Sequence::NextInstructionsImpl() const
 {
   std::vector<const Instruction*> result;
-  for (auto instruction : ChildInstructions())
+  auto idx = SkipSucceededChildren(m_cursor);
+  if (idx < NumberOfChildren() && ReadyForExecute(ChildAt(idx)->GetStatus()))
   {
-    auto child_status = instruction->GetStatus();
-    if (child_status == ExecutionStatus::SUCCESS)
-    {
-      continue;
-    }
-    if (ReadyForExecute(child_status))
-    {
-      result.push_back(instruction);
-      return result;
-    }
-    // There is no next when a child is encountered that has status FAILURE/RUNNING:
-    break;
+    result.push_back(ChildAt(idx));
   }
+  // There is no next when a child is encountered that has status FAILURE/RUNNING.
   return result;
 }
 
+void Sequence::ResetHook(UserInterface& ui)
+{
+  m_cursor = 0;
+  ResetChildren(ui);
+}
+
+std::size_t Sequence::SkipSucceededChildren(std::size_t idx) const
+{
+  const auto n_children = NumberOfChildren();
+  while (idx < n_children && ChildAt(idx)->GetStatus() == ExecutionStatus::SUCCESS)
+  {
+    ++idx;
+  }
+  return idx;
+}
+
 ExecutionStatus Sequence::CalculateCompoundStatus() const
 {
-  for (auto instruction : ChildInstructions())
+  auto idx = SkipSucceededChildren(m_cursor);
+  if (idx == NumberOfChildren())
   {
-    auto child_status = instruction->GetStatus();
-    if (child_status == ExecutionStatus::SUCCESS)
-    {
-      continue;
-    }
-    if (child_status == ExecutionStatus::NOT_STARTED
-        || child_status == ExecutionStatus::NOT_FINISHED)
-    {
-      return ExecutionStatus::NOT_FINISHED;
-    }
-    return child_status;
+    return ExecutionStatus::SUCCESS;
+  }
+  auto child_status = ChildAt(idx)->GetStatus();
+  if (child_status == ExecutionStatus::NOT_STARTED
+      || child_status == ExecutionStatus::NOT_FINISHED)
+  {
+    return ExecutionStatus::NOT_FINISHED;
   }
-  return ExecutionStatus::SUCCESS;
+  return child_status;
 }
 
 }  // namespace oac_tree
@@ -25,6 +25,8 @@
 
 #include <sup/oac-tree/compound_instruction.h>
 
+#include <atomic>
+
 namespace sup
 {
 namespace oac_tree
@@ -49,10 +51,25 @@ private:
 
   std::vector<const Instruction*> NextInstructionsImpl() const override;
 
+  void ResetHook(UserInterface& ui) override;
+
+  /**
+   * @brief Get the index of the first child from the given index on that did not succeed.
+   */
+  std::size_t SkipSucceededChildren(std::size_t idx) const;
+
   /**
    * @brief Calculate this instruction's status from the status of its child instructions.
    */
   ExecutionStatus CalculateCompoundStatus() const;
+
+  /**
+   * @brief Index of the child to execute next.
+   *
+   * @details All children before this index have status SUCCESS, so they don't need to be scanned
+   * again on each tick. The cursor is only advanced during execution and reset to zero on Reset.
+   */
+  std::atomic<std::size_t> m_cursor;
 };
 
 }  // namespace oac_tree
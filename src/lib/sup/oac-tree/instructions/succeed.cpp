@@ -46,6 +46,11 @@ ExecutionStatus Succeed::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   return ExecutionStatus::SUCCESS;
 }
 
+bool Succeed::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
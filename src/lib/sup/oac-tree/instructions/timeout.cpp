@@ -0,0 +1,113 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "timeout.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <chrono>
+
+namespace sup
+{
+namespace oac_tree
+{
+const std::string Timeout::Type = "Timeout";
+
+Timeout::Timeout()
+  : DecoratorInstruction(Timeout::Type)
+  , m_timer_guard{}
+  , m_expired{false}
+{
+  AddAttributeDefinition(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
+    .SetCategory(AttributeCategory::kBoth).SetMandatory();
+}
+
+Timeout::~Timeout() = default;
+
+bool Timeout::InitHook(UserInterface& ui, Workspace& ws)
+{
+  m_timer_guard = ScopeGuard{};
+  m_expired.store(false);
+  sup::dto::int64 timeout_ns{0};
+  if (!instruction_utils::GetVariableTimeoutAttribute(
+            *this, ui, ws, Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, timeout_ns))
+  {
+    return false;
+  }
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout_ns);
+  m_timer_guard = ws.ScheduleDeadline(deadline, [this, &ws]() { OnDeadline(ws); });
+  return true;
+}
+
+ExecutionStatus Timeout::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  if (!m_expired.load())
+  {
+    ExecuteChild(ui, ws);
+  }
+  if (m_expired.load())
+  {
+    m_timer_guard = ScopeGuard{};
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "child instruction did not finish before the timeout";
+    LogWarning(ui, warning_message);
+    return ExecutionStatus::FAILURE;
+  }
+  auto child_status = GetChildStatus();
+  if (IsFinishedStatus(child_status))
+  {
+    m_timer_guard = ScopeGuard{};
+  }
+  return child_status;
+}
+
+bool Timeout::IsNonBlockingImpl() const
+{
+  return IsChildNonBlocking();
+}
+
+bool Timeout::CompletesSynchronouslyImpl() const
+{
+  return ChildCompletesSynchronously();
+}
+
+void Timeout::ResetHook(UserInterface& ui)
+{
+  // Disarm the timer before resetting the child, so it cannot be halted after its reset:
+  m_timer_guard = ScopeGuard{};
+  m_expired.store(false);
+  ResetChild(ui);
+}
+
+void Timeout::OnDeadline(Workspace& ws)
+{
+  m_expired.store(true);
+  HaltChild();
+  ws.RequestTick();
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,75 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_TIMEOUT_H_
+#define SUP_OAC_TREE_TIMEOUT_H_
+
+#include <sup/oac-tree/decorator_instruction.h>
+
+#include <atomic>
+
+namespace sup
+{
+namespace oac_tree
+{
+/**
+ * @brief Decorator that fails when its child does not finish within a given timeout.
+ *
+ * @details The deadline is armed on the workspace's timer when the instruction starts. When it
+ * expires before the child finished, the timer halts the child, which also wakes up blocking
+ * child instructions through their cancellation token, and requests a new tick. The decorator
+ * then returns FAILURE. Otherwise, the child's status is returned. The deadline is never polled.
+ */
+class Timeout : public DecoratorInstruction
+{
+public:
+  Timeout();
+
+  ~Timeout() override;
+
+  static const std::string Type;
+
+private:
+  bool InitHook(UserInterface& ui, Workspace& ws) override;
+
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+
+  bool IsNonBlockingImpl() const override;
+
+  bool CompletesSynchronouslyImpl() const override;
+
+  void ResetHook(UserInterface& ui) override;
+
+  /**
+   * @brief Called from the workspace's timer thread when the deadline expires.
+   */
+  void OnDeadline(Workspace& ws);
+
+  ScopeGuard m_timer_guard;
+  std::atomic<bool> m_expired;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_TIMEOUT_H_
@@ -95,7 +95,7 @@ ExecutionStatus UserChoice::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
     m_choice = choice;
     return ExecutionStatus::NOT_FINISHED;  // TODO: remove this if we no longer need this...
   }
-  auto selected = ChildInstructions()[m_choice];
+  auto selected = Children()[static_cast<std::size_t>(m_choice)];
   selected->ExecuteSingle(ui, ws);
   return selected->GetStatus();
 }
@@ -119,7 +119,7 @@ std::vector<const Instruction*> UserChoice::NextInstructionsImpl() const
   {
     return result;
   }
-  auto instruction = ChildInstructions()[m_choice];
+  auto instruction = Children()[static_cast<std::size_t>(m_choice)];
   if (ReadyForExecute(instruction->GetStatus()))
   {
     result.push_back(instruction);
@@ -127,10 +127,16 @@ std::vector<const Instruction*> UserChoice::NextInstructionsImpl() const
   return result;
 }
 
+bool UserChoice::CompletesSynchronouslyImpl() const
+{
+  // Waits for the user's choice.
+  return false;
+}
+
 std::vector<std::string> UserChoice::GetChoices() const
 {
   std::vector<std::string> option_names;
-  for (auto instruction : ChildInstructions())
+  for (auto instruction : Children())
   {
     std::string description = instruction->GetName() + " (type:" + instruction->GetType() + ")";
     option_names.push_back(description);
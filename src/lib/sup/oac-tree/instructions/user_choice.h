@@ -61,6 +61,8 @@ private:
 
   std::vector<const Instruction*> NextInstructionsImpl() const override;
 
+  bool CompletesSynchronouslyImpl() const override;
+
   /**
    * @brief Construct a list of choices from the available child instructions.
    */
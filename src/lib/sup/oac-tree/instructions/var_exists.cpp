@@ -51,6 +51,11 @@ ExecutionStatus VarExistsInstruction::ExecuteSingleImpl(UserInterface& ui, Works
   return ExecutionStatus::SUCCESS;
 }
 
+bool VarExistsInstruction::IsNonBlockingImpl() const
+{
+  return true;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
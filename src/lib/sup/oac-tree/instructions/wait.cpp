@@ -22,15 +22,12 @@
 
 #include "wait.h"
 
-#include "sup/oac-tree/procedure.h"
 #include <sup/oac-tree/constants.h>
 #include <sup/oac-tree/exceptions.h>
 #include <sup/oac-tree/instruction_utils.h>
-#include <sup/oac-tree/generic_utils.h>
 #include <sup/oac-tree/user_interface.h>
 
 #include <chrono>
-#include <thread>
 
 namespace sup
 {
@@ -41,8 +38,7 @@ const std::string Wait::Type = "Wait";
 Wait::Wait()
   : Instruction(Wait::Type)
   , m_blocking{false}
-  , m_timing_accuracy_ns{}
-  , m_finish{}
+  , m_deadline{}
 {
   AddAttributeDefinition(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
     .SetCategory(AttributeCategory::kBoth);
@@ -52,11 +48,6 @@ Wait::Wait()
 
 Wait::~Wait() = default;
 
-void Wait::SetupImpl(const Procedure& proc)
-{
-  m_timing_accuracy_ns = TimingAccuracyNs(proc);
-}
-
 bool Wait::InitHook(UserInterface& ui, Workspace& ws)
 {
   if (!GetAttributeValueAs(Constants::BLOCKING_ATTRIBUTE_NAME, ws, ui, m_blocking))
@@ -69,7 +60,7 @@ bool Wait::InitHook(UserInterface& ui, Workspace& ws)
   {
     return false;
   }
-  m_finish = utils::GetNanosecsSinceEpoch() + timeout_ns;
+  m_deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout_ns);
   return true;
 }
 
@@ -79,19 +70,15 @@ ExecutionStatus Wait::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
   (void)ws;
   if (m_blocking)
   {
-    while (!IsHaltRequested() && m_finish > utils::GetNanosecsSinceEpoch())
-    {
-      std::this_thread::sleep_for(std::chrono::nanoseconds(m_timing_accuracy_ns));
-    }
+    (void)GetCancellationToken().WaitUntilPrecise(m_deadline);
   }
-  auto now = utils::GetNanosecsSinceEpoch();
-  if (!IsHaltRequested() && m_finish > now)
+  if (GetCancellationToken().IsCancelled())
   {
-    return ExecutionStatus::RUNNING;
+    return ExecutionStatus::FAILURE;
   }
-  if (IsHaltRequested())
+  if (std::chrono::steady_clock::now() < m_deadline)
   {
-    return ExecutionStatus::FAILURE;
+    return ExecutionStatus::RUNNING;
   }
   return ExecutionStatus::SUCCESS;
 }
@@ -100,7 +87,7 @@ void Wait::ResetHook(UserInterface& ui)
 {
   (void)ui;
   m_blocking = false;
-  m_finish = 0;
+  m_deadline = {};
 }
 
 }  // namespace oac_tree
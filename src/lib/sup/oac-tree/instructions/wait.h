@@ -25,6 +25,8 @@
 
 #include <sup/oac-tree/instruction.h>
 
+#include <chrono>
+
 namespace sup
 {
 namespace oac_tree
@@ -34,6 +36,10 @@ namespace oac_tree
  *
  * @details The 'timeout' attribute is optional. When this attribute is not present,
  * the instruction returns SUCCESS immediately.
+ *
+ * A blocking wait sleeps on the instruction's cancellation token until a steady clock deadline, so
+ * it is woken up immediately when it or one of its ancestors is halted. The last part of the wait
+ * is spent spinning to improve accuracy.
  */
 class Wait : public Instruction
 {
@@ -45,8 +51,6 @@ public:
   static const std::string Type;
 
 private:
-  void SetupImpl(const Procedure& proc) override;
-
   bool InitHook(UserInterface& ui, Workspace& ws) override;
 
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
@@ -54,8 +58,7 @@ private:
   void ResetHook(UserInterface& ui) override;
 
   bool m_blocking;
-  sup::dto::int64 m_timing_accuracy_ns;
-  sup::dto::int64 m_finish;
+  std::chrono::steady_clock::time_point m_deadline;
 };
 
 }  // namespace oac_tree
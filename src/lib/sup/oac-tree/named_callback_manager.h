@@ -40,7 +40,9 @@ namespace oac_tree
  * @brief Threadsafe class template for managing a list of callbacks and executing them.
  *
  * @note Generic callbacks will be convertible to std::function<void(const std::string&, Args...)>,
- * while callbacks for a specific name will be convertible to std::function<void(Args...)>.
+ * while callbacks for a specific name will be convertible to std::function<void(Args...)>. Batch
+ * callbacks will be convertible to std::function<void(const std::vector<std::string>&)> and are
+ * called once for a group of names that were updated together.
  */
 template <typename... Args>
 class NamedCallbackManager
@@ -54,10 +56,15 @@ public:
   bool RegisterCallback(const std::string& name,
                         const std::function<void(Args...)>& cb, void* listener);
 
+  bool RegisterBatchCallback(std::function<void(const std::vector<std::string>&)> cb,
+                             void* listener);
+
   bool UnregisterListener(void* listener);
 
   void ExecuteCallbacks(const std::string& name, Args... args) const;
 
+  void ExecuteBatchCallbacks(const std::vector<std::string>& names) const;
+
   ScopeGuard GetCallbackGuard(void* listener);
 
 private:
@@ -72,9 +79,15 @@ private:
     std::string name;
     std::function<void(Args...)> cb;
   };
+  struct BatchCallbackEntry
+  {
+    void* listener;
+    std::function<void(const std::vector<std::string>&)> cb;
+  };
   mutable std::mutex mtx;
   std::vector<GenericCallbackEntry> generic_cb_entries;
   std::vector<CallbackEntry> cb_entries;
+  std::vector<BatchCallbackEntry> batch_cb_entries;
 };
 
 template <typename... Args>
@@ -104,6 +117,19 @@ bool NamedCallbackManager<Args...>::RegisterCallback(
   return true;
 }
 
+template <typename... Args>
+bool NamedCallbackManager<Args...>::RegisterBatchCallback(
+    std::function<void(const std::vector<std::string>&)> cb, void* listener)
+{
+  if (!cb)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lk(mtx);
+  batch_cb_entries.push_back({listener, cb});
+  return true;
+}
+
 template <typename... Args>
 bool NamedCallbackManager<Args...>::UnregisterListener(void* listener)
 {
@@ -119,6 +145,11 @@ bool NamedCallbackManager<Args...>::UnregisterListener(void* listener)
                      [listener](CallbackEntry cb_entry) { return cb_entry.listener == listener; });
   result = result || new_end_it != cb_entries.end();
   cb_entries.erase(new_end_it, cb_entries.end());
+  auto new_batch_end_it = std::remove_if(batch_cb_entries.begin(), batch_cb_entries.end(),
+                                         [listener](BatchCallbackEntry cb_entry)
+                                         { return cb_entry.listener == listener; });
+  result = result || new_batch_end_it != batch_cb_entries.end();
+  batch_cb_entries.erase(new_batch_end_it, batch_cb_entries.end());
   return result;
 }
 
@@ -139,6 +170,16 @@ void NamedCallbackManager<Args...>::ExecuteCallbacks(const std::string& name, Ar
   }
 }
 
+template <typename... Args>
+void NamedCallbackManager<Args...>::ExecuteBatchCallbacks(const std::vector<std::string>& names) const
+{
+  std::lock_guard<std::mutex> lk(mtx);
+  for (const auto& cb_entry : batch_cb_entries)
+  {
+    cb_entry.cb(names);
+  }
+}
+
 template <typename... Args>
 ScopeGuard NamedCallbackManager<Args...>::GetCallbackGuard(void* listener)
 {
@@ -55,6 +55,7 @@ class Workspace;
 
 const std::string kTickTimeoutAttributeName = "tickTimeout";
 const std::string kTimingAccuracyAttributeName = "timingAccuracy";
+const std::string kMaxMicroTicksAttributeName = "maxMicroTicks";
 
 /**
  * @brief Procedure contains a tree of instructions
@@ -207,8 +208,9 @@ public:
    *
    * @param ui UserInterface to use for instruction status updates.
    *
-   * @details All workspaces are torn down and setup again; instructions receive a reset command.
-   * The procedure can be started afterwards in a fresh state.
+   * @details Instructions receive a reset command and all workspaces are reset, i.e. their variables
+   * are restored to their state just after setup. The procedure can be started afterwards in a
+   * fresh state.
    */
   void Reset(UserInterface& ui);
 
@@ -380,6 +382,16 @@ sup::dto::int64 TickTimeoutNs(const Procedure& procedure);
  */
 sup::dto::int64 TimingAccuracyNs(const Procedure& procedure);
 
+/**
+ * @brief Query the maximum number of execution steps the procedure wants in a single tick.
+ *
+ * @returns Maximum number of steps per tick (attribute or default value), at least one.
+ *
+ * @details Runners may keep executing steps within a tick until the procedure finishes, reports
+ * RUNNING (blocked) or this limit is reached. Applications are free to ignore this setting.
+ */
+sup::dto::uint32 MaxMicroTicks(const Procedure& procedure);
+
 /**
  * @brief Get the name of the procedure.
  *
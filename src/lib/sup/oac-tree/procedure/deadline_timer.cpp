@@ -0,0 +1,148 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/oac-tree/procedure/deadline_timer.h>
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+struct DeadlineTimer::State
+{
+  using Queue = std::multimap<std::chrono::steady_clock::time_point,
+                              std::pair<sup::dto::uint64, Callback>>;
+
+  void Cancel(sup::dto::uint64 id);
+
+  std::mutex m_mtx{};
+  std::condition_variable m_cv{};
+  std::condition_variable m_done_cv{};
+  Queue m_queue{};
+  std::map<sup::dto::uint64, Queue::iterator> m_entries{};
+  sup::dto::uint64 m_last_id{0};
+  sup::dto::uint64 m_running_id{0};
+  std::thread::id m_worker_id{};
+  bool m_halt{false};
+};
+
+DeadlineTimer::DeadlineTimer()
+  : m_state{std::make_shared<State>()}
+  , m_worker{}
+{}
+
+DeadlineTimer::~DeadlineTimer()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_state->m_mtx};
+    m_state->m_halt = true;
+    m_state->m_queue.clear();
+    m_state->m_entries.clear();
+  }
+  m_state->m_cv.notify_all();
+  if (m_worker.joinable())
+  {
+    m_worker.join();
+  }
+}
+
+ScopeGuard DeadlineTimer::Schedule(std::chrono::steady_clock::time_point deadline,
+                                   Callback callback)
+{
+  sup::dto::uint64 id{0};
+  {
+    std::lock_guard<std::mutex> lk{m_state->m_mtx};
+    if (!m_worker.joinable())
+    {
+      m_worker = std::thread(&DeadlineTimer::Run, m_state);
+    }
+    id = ++m_state->m_last_id;
+    auto queue_it = m_state->m_queue.emplace(deadline, std::make_pair(id, std::move(callback)));
+    m_state->m_entries[id] = queue_it;
+  }
+  // The new deadline may be earlier than the one the worker is waiting for:
+  m_state->m_cv.notify_all();
+  std::weak_ptr<State> weak_state = m_state;
+  return ScopeGuard{[weak_state, id]() {
+    if (auto state = weak_state.lock())
+    {
+      state->Cancel(id);
+    }
+  }};
+}
+
+void DeadlineTimer::Run(std::shared_ptr<State> state)
+{
+  std::unique_lock<std::mutex> lk{state->m_mtx};
+  state->m_worker_id = std::this_thread::get_id();
+  while (!state->m_halt)
+  {
+    if (state->m_queue.empty())
+    {
+      state->m_cv.wait(lk, [&state]() { return state->m_halt || !state->m_queue.empty(); });
+      continue;
+    }
+    auto first_it = state->m_queue.begin();
+    if (std::chrono::steady_clock::now() < first_it->first)
+    {
+      state->m_cv.wait_until(lk, first_it->first);
+      continue;
+    }
+    auto [id, callback] = std::move(first_it->second);
+    state->m_queue.erase(first_it);
+    state->m_entries.erase(id);
+    state->m_running_id = id;
+    lk.unlock();
+    callback();
+    lk.lock();
+    state->m_running_id = 0;
+    state->m_done_cv.notify_all();
+  }
+}
+
+void DeadlineTimer::State::Cancel(sup::dto::uint64 id)
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  auto entry_it = m_entries.find(id);
+  if (entry_it != m_entries.end())
+  {
+    m_queue.erase(entry_it->second);
+    m_entries.erase(entry_it);
+    return;
+  }
+  // A callback cancelling itself from the worker thread must not wait for itself:
+  if (std::this_thread::get_id() != m_worker_id)
+  {
+    m_done_cv.wait(lk, [this, id]() { return m_running_id != id; });
+  }
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_DEADLINE_TIMER_H_
+#define SUP_OAC_TREE_DEADLINE_TIMER_H_
+
+#include <sup/oac-tree/scope_guard.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief DeadlineTimer calls scheduled callbacks at steady clock deadlines from a single worker
+ * thread, which is only started when the first callback is scheduled.
+ *
+ * @details Callbacks are called without internal locks being held, but they should return quickly
+ * since they delay the other callbacks, e.g. by only signalling the code that needs to react.
+ * Scheduled callbacks that are pending when the timer is destroyed are never called.
+ */
+class DeadlineTimer
+{
+public:
+  using Callback = std::function<void()>;
+
+  DeadlineTimer();
+  ~DeadlineTimer();
+
+  DeadlineTimer(const DeadlineTimer& other) = delete;
+  DeadlineTimer& operator=(const DeadlineTimer& other) = delete;
+
+  /**
+   * @brief Schedule a callback to be called once when the deadline passes.
+   *
+   * @param deadline Deadline on the steady clock.
+   * @param callback Callback function.
+   * @return Guard that cancels the callback when destroyed. When the callback is running at that
+   * moment (on another thread), the destruction of the guard waits until it has returned. The
+   * guard can safely outlive the timer.
+   */
+  ScopeGuard Schedule(std::chrono::steady_clock::time_point deadline, Callback callback);
+
+private:
+  struct State;
+  static void Run(std::shared_ptr<State> state);
+  std::shared_ptr<State> m_state;
+  std::thread m_worker;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_DEADLINE_TIMER_H_
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+
+#include "parsed_type_cache.h"
+
+#include <sup/dto/anytype_registry.h>
+#include <sup/dto/json_type_parser.h>
+#include <sup/dto/json_value_parser.h>
+
+#include <memory>
+
+namespace
+{
+// Values with longer JSON representations are not cached, since they are unlikely to repeat.
+const std::size_t kMaxCachedValueLength = 256;
+
+// Maximum number of cached values; further values are parsed without being cached.
+const std::size_t kMaxCachedValues = 1024;
+}  // unnamed namespace
+
+namespace sup
+{
+namespace oac_tree
+{
+
+ParsedTypeCache::ParsedTypeCache(const sup::dto::AnyTypeRegistry& registry)
+  : m_registry{registry}
+  , m_types{}
+  , m_values{}
+  , m_mtx{}
+{}
+
+ParsedTypeCache::~ParsedTypeCache() = default;
+
+bool ParsedTypeCache::ParseType(const std::string& json_type, sup::dto::AnyType& anytype)
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return ParseTypeImpl(json_type, anytype);
+}
+
+bool ParsedTypeCache::ParseValue(const std::string& json_type, const std::string& json_value,
+                                 sup::dto::AnyValue& anyvalue)
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  const bool cacheable = json_value.size() <= kMaxCachedValueLength;
+  if (cacheable)
+  {
+    auto it = m_values.find(std::make_pair(json_type, json_value));
+    if (it != m_values.end())
+    {
+      anyvalue = it->second;
+      return true;
+    }
+  }
+  sup::dto::AnyType anytype;
+  if (!ParseTypeImpl(json_type, anytype))
+  {
+    return false;
+  }
+  sup::dto::JSONAnyValueParser value_parser;
+  if (!value_parser.TypedParseString(anytype, json_value))
+  {
+    return false;
+  }
+  if (!cacheable || m_values.size() >= kMaxCachedValues)
+  {
+    anyvalue = value_parser.MoveAnyValue();
+    return true;
+  }
+  auto result =
+    m_values.emplace(std::make_pair(json_type, json_value), value_parser.MoveAnyValue());
+  anyvalue = result.first->second;
+  return true;
+}
+
+bool ParsedTypeCache::ParseTypeImpl(const std::string& json_type, sup::dto::AnyType& anytype)
+{
+  auto it = m_types.find(json_type);
+  if (it != m_types.end())
+  {
+    anytype = it->second;
+    return true;
+  }
+  sup::dto::JSONAnyTypeParser type_parser;
+  if (!type_parser.ParseString(json_type, std::addressof(m_registry)))
+  {
+    return false;
+  }
+  auto result = m_types.emplace(json_type, type_parser.MoveAnyType());
+  anytype = result.first->second;
+  return true;
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
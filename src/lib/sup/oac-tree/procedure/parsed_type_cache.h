@@ -0,0 +1,94 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PARSED_TYPE_CACHE_H_
+#define SUP_OAC_TREE_PARSED_TYPE_CACHE_H_
+
+#include <sup/dto/anyvalue.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace sup
+{
+namespace dto
+{
+class AnyTypeRegistry;
+}  // namespace dto
+
+namespace oac_tree
+{
+
+/**
+ * @brief ParsedTypeCache stores the results of parsing JSON type and value representations with a
+ * specific type registry, so identical strings are only parsed once.
+ *
+ * @note Only successful parse results are cached: a type that failed to parse may become valid
+ * after registering extra types. Since types cannot be overwritten in a registry, cached results
+ * remain valid for the lifetime of the registry. Values are only cached when their JSON
+ * representation is short and up to a maximum number of entries, so large or unique values (e.g.
+ * arrays) do not grow the cache without bound.
+ */
+class ParsedTypeCache
+{
+public:
+  explicit ParsedTypeCache(const sup::dto::AnyTypeRegistry& registry);
+  ~ParsedTypeCache();
+
+  /**
+   * @brief Parse a type from its JSON representation.
+   *
+   * @param json_type JSON representation of the type.
+   * @param anytype Output parameter for the parsed type.
+   *
+   * @return true on success.
+   */
+  bool ParseType(const std::string& json_type, sup::dto::AnyType& anytype);
+
+  /**
+   * @brief Parse a value of the given type from its JSON representation.
+   *
+   * @param json_type JSON representation of the value's type.
+   * @param json_value JSON representation of the value.
+   * @param anyvalue Output parameter for the parsed value.
+   *
+   * @return true on success.
+   */
+  bool ParseValue(const std::string& json_type, const std::string& json_value,
+                  sup::dto::AnyValue& anyvalue);
+
+private:
+  bool ParseTypeImpl(const std::string& json_type, sup::dto::AnyType& anytype);
+  const sup::dto::AnyTypeRegistry& m_registry;
+  std::map<std::string, sup::dto::AnyType> m_types;
+  std::map<std::pair<std::string, std::string>, sup::dto::AnyValue> m_values;
+  std::mutex m_mtx;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PARSED_TYPE_CACHE_H_
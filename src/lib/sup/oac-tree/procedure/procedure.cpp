@@ -40,6 +40,8 @@
 #include <sup/dto/anytype_helper.h>
 #include <sup/dto/json_type_parser.h>
 
+#include <algorithm>
+
 namespace
 {
 using sup::oac_tree::Instruction;
@@ -61,6 +63,8 @@ Procedure::Procedure(const std::string& filename)
 {
   m_attribute_handler.AddAttributeDefinition(kTickTimeoutAttributeName, sup::dto::Float64Type);
   m_attribute_handler.AddAttributeDefinition(kTimingAccuracyAttributeName, sup::dto::Float64Type);
+  m_attribute_handler.AddAttributeDefinition(kMaxMicroTicksAttributeName,
+                                             sup::dto::UnsignedInteger32Type);
 }
 
 Procedure::~Procedure()
@@ -218,13 +222,13 @@ void Procedure::Halt()
 
 void Procedure::Reset(UserInterface& ui)
 {
-  m_workspace->Teardown();
-  m_procedure_store->ResetProcedureWorkspaces(ui);
+  // Instructions are reset first, so no running instruction can overwrite the restored values.
   if (RootInstruction() != nullptr)
   {
     RootInstruction()->Reset(ui);
   }
-  m_workspace->Setup();
+  m_procedure_store->ResetProcedureWorkspaces(ui);
+  m_workspace->Reset();
 }
 
 ExecutionStatus Procedure::GetStatus() const
@@ -359,6 +363,16 @@ sup::dto::int64 TimingAccuracyNs(const Procedure& procedure)
   return timing_accuracy_ns;
 }
 
+sup::dto::uint32 MaxMicroTicks(const Procedure& procedure)
+{
+  sup::dto::uint32 max_micro_ticks = DefaultSettings::DEFAULT_MAX_MICRO_TICKS;
+  if (procedure.HasAttribute(kMaxMicroTicksAttributeName))
+  {
+    max_micro_ticks = procedure.GetAttributeValue<sup::dto::uint32>(kMaxMicroTicksAttributeName);
+  }
+  return std::max(max_micro_ticks, sup::dto::uint32{1});
+}
+
 std::string GetProcedureName(const Procedure& procedure)
 {
   if (procedure.HasAttribute(Constants::NAME_ATTRIBUTE_NAME))
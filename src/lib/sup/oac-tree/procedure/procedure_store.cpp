@@ -63,9 +63,7 @@ void ProcedureStore::ResetProcedureWorkspaces(UserInterface& ui) const
 {
   for (auto& [_, procedure] : m_procedure_cache)
   {
-    auto& ws = procedure->GetWorkspace();
-    ws.Teardown();
-    ws.Setup();
+    procedure->GetWorkspace().Reset();
   }
 }
 
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/oac-tree/procedure/worker_pool.h>
+
+#include <utility>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+WorkerPool::WorkerPool()
+  : m_mtx{}
+  , m_cv{}
+  , m_tasks{}
+  , m_workers{}
+  , m_n_idle{0}
+  , m_halt{false}
+{}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    m_halt = true;
+  }
+  m_cv.notify_all();
+  for (auto& worker : m_workers)
+  {
+    worker.join();
+  }
+}
+
+void WorkerPool::Submit(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    m_tasks.push_back(std::move(task));
+    // Every idle worker takes exactly one of the queued tasks:
+    if (m_tasks.size() > m_n_idle)
+    {
+      m_workers.emplace_back(&WorkerPool::Run, this);
+    }
+  }
+  m_cv.notify_one();
+}
+
+void WorkerPool::Run()
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  while (true)
+  {
+    if (m_tasks.empty())
+    {
+      if (m_halt)
+      {
+        return;
+      }
+      ++m_n_idle;
+      m_cv.wait(lk, [this]() { return m_halt || !m_tasks.empty(); });
+      --m_n_idle;
+      continue;
+    }
+    auto task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    lk.unlock();
+    task();
+    lk.lock();
+  }
+}
+
+}  // namespace oac_tree
+
+}  // namespace sup
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_OAC_TREE_WORKER_POOL_H_
+#define SUP_OAC_TREE_WORKER_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief WorkerPool runs submitted tasks on a set of reusable worker threads.
+ *
+ * @details A new worker thread is only started when a task is submitted while all existing
+ * workers are busy. Idle workers wait for new tasks until the pool is destroyed, so repeated
+ * executions do not pay for thread creation. Since tasks never wait for a free worker, tasks can
+ * safely block until other tasks make progress.
+ */
+class WorkerPool
+{
+public:
+  using Task = std::function<void()>;
+
+  WorkerPool();
+
+  /**
+   * @brief Destructor. Runs all pending tasks and joins the worker threads.
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool& other) = delete;
+  WorkerPool& operator=(const WorkerPool& other) = delete;
+
+  /**
+   * @brief Run a task on one of the worker threads.
+   *
+   * @param task Task to run.
+   */
+  void Submit(Task task);
+
+private:
+  void Run();
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::deque<Task> m_tasks;
+  std::vector<std::thread> m_workers;
+  std::size_t m_n_idle;
+  bool m_halt;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_WORKER_POOL_H_
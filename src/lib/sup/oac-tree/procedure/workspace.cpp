@@ -22,17 +22,41 @@
 
 #include <sup/oac-tree/workspace.h>
 
+#include <sup/oac-tree/procedure/deadline_timer.h>
+#include <sup/oac-tree/procedure/parsed_type_cache.h>
+#include <sup/oac-tree/procedure/worker_pool.h>
+
 #include <sup/oac-tree/exceptions.h>
 
 #include <sup/dto/anytype_registry.h>
+#include <sup/dto/anyvalue_helper.h>
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <set>
 #include <mutex>
 #include <utility>
 
+namespace
+{
+bool GetStagedField(const sup::dto::AnyValue& staged, const std::string& fieldname,
+                    sup::dto::AnyValue& value);
+
+bool SetStagedField(sup::dto::AnyValue& staged, const std::string& fieldname,
+                    const sup::dto::AnyValue& value, bool dynamically_typed);
+
+using ActionMember = std::function<void()> sup::oac_tree::SetupTeardownActions::*;
+
+/**
+ * @brief Select the setup or teardown functions from a list of actions, keeping only the first one
+ * for each identifier.
+ */
+std::vector<std::function<void()>> UniqueActions(
+  const std::vector<sup::oac_tree::SetupTeardownActions>& actions, ActionMember member);
+}  // unnamed namespace
+
 namespace sup
 {
 namespace oac_tree
@@ -43,12 +67,29 @@ Workspace::Workspace(const std::string& filename)
    , m_var_names{}
    , m_callbacks{}
    , m_type_registry{new sup::dto::AnyTypeRegistry()}
+   , m_type_cache{new ParsedTypeCache(*m_type_registry)}
    , m_teardown_actions{}
+   , m_variable_actions{}
    , m_setup_done{false}
+   , m_transactions{}
+   , m_transactions_mutex{}
+   , m_n_transactions{0}
+   , m_local_bindings{}
+   , m_local_bindings_mutex{}
+   , m_n_local_bindings{0}
+   , m_tick_requested{false}
+   , m_tick_mutex{}
+   , m_tick_cv{}
+   , m_timer{new DeadlineTimer{}}
+   , m_worker_pool{new WorkerPool{}}
 {}
 
 Workspace::~Workspace()
 {
+  // Stop the worker threads and the timer first, so no tasks or callbacks run while the variables
+  // are torn down:
+  m_worker_pool.reset();
+  m_timer.reset();
   for (const auto& teardown_action : m_teardown_actions)
   {
     teardown_action();
@@ -90,16 +131,16 @@ void Workspace::Setup()
   {
     return;
   }
-  std::vector<SetupTeardownActions> setup_teardown_actions;
-  auto setup_var = [this, &setup_teardown_actions](const auto &pair) {
+  m_variable_actions.clear();
+  auto setup_var = [this](const auto &pair) {
     auto actions = pair.second->Setup(*this);
     if (!actions.m_identifier.empty()) {
-      setup_teardown_actions.push_back(actions);
+      m_variable_actions[pair.first] = actions;
     }
   };
   std::for_each(m_var_map.begin(), m_var_map.end(), setup_var);
   // call registered global setup functions
-  auto setup_actions = ParseSetupTeardownActions(setup_teardown_actions);
+  auto setup_actions = ParseSetupTeardownActions(GetVariableActions());
   for (const auto& setup_action : setup_actions)
   {
     setup_action();
@@ -115,10 +156,66 @@ void Workspace::Teardown()
     teardown_action();
   }
   m_teardown_actions.clear();
+  m_variable_actions.clear();
   std::for_each(m_var_map.begin(), m_var_map.end(), [](const auto &pair) {
      return pair.second->Teardown(); });
 }
 
+void Workspace::Reset()
+{
+  if (!m_setup_done)
+  {
+    Setup();
+    return;
+  }
+  // Variables without an in-place reset are torn down and set up again, including the global
+  // actions they registered:
+  std::vector<std::pair<std::string, Variable*>> full_reset_vars;
+  std::vector<SetupTeardownActions> old_actions;
+  for (const auto& [name, var] : m_var_map)
+  {
+    if (var->HasInPlaceReset())
+    {
+      var->Reset(*this);
+      continue;
+    }
+    full_reset_vars.emplace_back(name, var.get());
+    auto actions_it = m_variable_actions.find(name);
+    if (actions_it != m_variable_actions.end())
+    {
+      old_actions.push_back(actions_it->second);
+      m_variable_actions.erase(actions_it);
+    }
+  }
+  if (full_reset_vars.empty())
+  {
+    return;
+  }
+  for (const auto& teardown_action : UniqueActions(old_actions, &SetupTeardownActions::m_teardown))
+  {
+    teardown_action();
+  }
+  for (const auto& [name, var] : full_reset_vars)
+  {
+    var->Teardown();
+  }
+  std::vector<SetupTeardownActions> new_actions;
+  for (const auto& [name, var] : full_reset_vars)
+  {
+    auto actions = var->Setup(*this);
+    if (!actions.m_identifier.empty())
+    {
+      m_variable_actions[name] = actions;
+      new_actions.push_back(actions);
+    }
+  }
+  (void)ParseSetupTeardownActions(GetVariableActions());
+  for (const auto& setup_action : UniqueActions(new_actions, &SetupTeardownActions::m_setup))
+  {
+    setup_action();
+  }
+}
+
 bool Workspace::ResetVariable(const std::string& varname)
 {
   auto it = m_var_map.find(varname);
@@ -139,9 +236,44 @@ bool Workspace::GetValue(const std::string& name, sup::dto::AnyValue &value) con
   {
     return false;
   }
+  if (auto binding = GetLocalBinding(varname))
+  {
+    return GetStagedField(*binding, fieldname, value);
+  }
+  if (auto transaction = GetTransaction())
+  {
+    auto staged_it = transaction->find(varname);
+    if (staged_it != transaction->end())
+    {
+      return GetStagedField(staged_it->second.m_value, fieldname, value);
+    }
+  }
   return it->second->GetValue(value, fieldname);
 }
 
+std::shared_ptr<const sup::dto::AnyValue> Workspace::GetSnapshot(const std::string& name) const
+{
+  auto [varname, fieldname] = SplitFieldName(name);
+
+  auto it = m_var_map.find(varname);
+  if (it == m_var_map.end())
+  {
+    return nullptr;
+  }
+  auto transaction = GetTransaction();
+  if (fieldname.empty() && !GetLocalBinding(varname)
+      && (!transaction || transaction->find(varname) == transaction->end()))
+  {
+    return it->second->GetSnapshot();
+  }
+  auto value = std::make_shared<sup::dto::AnyValue>();
+  if (!GetValue(name, *value))
+  {
+    return nullptr;
+  }
+  return value;
+}
+
 bool Workspace::SetValue(const std::string& name, const sup::dto::AnyValue &value)
 {
   auto [varname, fieldname] = SplitFieldName(name);
@@ -151,9 +283,174 @@ bool Workspace::SetValue(const std::string& name, const sup::dto::AnyValue &valu
   {
     return false;
   }
+  if (auto binding = GetLocalBinding(varname))
+  {
+    return SetStagedField(*binding, fieldname, value, it->second->IsDynamicallyTyped());
+  }
+  if (auto transaction = GetTransaction())
+  {
+    auto& staged = StageVariable(*transaction, varname, *it->second);
+    return SetStagedField(staged, fieldname, value, it->second->IsDynamicallyTyped());
+  }
   return it->second->SetValue(value, fieldname);
 }
 
+bool Workspace::UpdateValue(const std::string& name, const Variable::UpdateFunction& func)
+{
+  auto [varname, fieldname] = SplitFieldName(name);
+
+  auto it = m_var_map.find(varname);
+  if (it == m_var_map.end())
+  {
+    return false;
+  }
+  auto binding = GetLocalBinding(varname);
+  auto transaction = binding ? nullptr : GetTransaction();
+  if (binding || transaction)
+  {
+    auto& staged = binding ? *binding : StageVariable(*transaction, varname, *it->second);
+    sup::dto::AnyValue field_copy;
+    if (!GetStagedField(staged, fieldname, field_copy) || !func(field_copy))
+    {
+      return false;
+    }
+    return SetStagedField(staged, fieldname, field_copy, it->second->IsDynamicallyTyped());
+  }
+  return it->second->UpdateValue(func, fieldname);
+}
+
+bool Workspace::UpdateValueInPlace(const std::string& name, const Variable::UpdateFunction& func)
+{
+  auto [varname, fieldname] = SplitFieldName(name);
+
+  auto it = m_var_map.find(varname);
+  if (it == m_var_map.end())
+  {
+    return false;
+  }
+  if (GetLocalBinding(varname) || HasTransaction())
+  {
+    return UpdateValue(name, func);
+  }
+  return it->second->UpdateValueInPlace(func, fieldname);
+}
+
+bool Workspace::CompareAndSwap(const std::string& name, const sup::dto::AnyValue& expected,
+                               const sup::dto::AnyValue& desired)
+{
+  auto [varname, fieldname] = SplitFieldName(name);
+
+  auto it = m_var_map.find(varname);
+  if (it == m_var_map.end())
+  {
+    return false;
+  }
+  if (GetLocalBinding(varname) || HasTransaction())
+  {
+    auto func = [&expected, &desired](sup::dto::AnyValue& value)
+    {
+      if (value != expected)
+      {
+        return false;
+      }
+      value = desired;
+      return true;
+    };
+    return UpdateValue(name, func);
+  }
+  return it->second->CompareAndSwap(expected, desired, fieldname);
+}
+
+bool Workspace::BeginTransaction()
+{
+  std::lock_guard<std::mutex> lk(m_transactions_mutex);
+  auto result = m_transactions.emplace(std::this_thread::get_id(), Transaction{});
+  if (!result.second)
+  {
+    return false;
+  }
+  ++m_n_transactions;
+  return true;
+}
+
+bool Workspace::CommitTransaction()
+{
+  Transaction transaction;
+  {
+    std::lock_guard<std::mutex> lk(m_transactions_mutex);
+    auto it = m_transactions.find(std::this_thread::get_id());
+    if (it == m_transactions.end())
+    {
+      return false;
+    }
+    transaction = std::move(it->second);
+    m_transactions.erase(it);
+    --m_n_transactions;
+  }
+  return ApplyTransaction(transaction);
+}
+
+void Workspace::AbortTransaction()
+{
+  std::lock_guard<std::mutex> lk(m_transactions_mutex);
+  if (m_transactions.erase(std::this_thread::get_id()) > 0)
+  {
+    --m_n_transactions;
+  }
+}
+
+bool Workspace::HasTransaction() const
+{
+  return GetTransaction() != nullptr;
+}
+
+bool Workspace::BindLocalValue(const std::string& name, const sup::dto::AnyValue& value)
+{
+  auto [varname, fieldname] = SplitFieldName(name);
+
+  auto it = m_var_map.find(varname);
+  if (it == m_var_map.end())
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lk(m_local_bindings_mutex);
+  auto& bindings = m_local_bindings[std::this_thread::get_id()];
+  auto binding_it = bindings.find(varname);
+  if (binding_it != bindings.end())
+  {
+    return SetStagedField(binding_it->second, fieldname, value,
+                          it->second->IsDynamicallyTyped());
+  }
+  sup::dto::AnyValue binding;
+  if (!fieldname.empty())
+  {
+    (void)it->second->GetValue(binding);
+  }
+  if (!SetStagedField(binding, fieldname, value, it->second->IsDynamicallyTyped()))
+  {
+    if (bindings.empty())
+    {
+      m_local_bindings.erase(std::this_thread::get_id());
+    }
+    return false;
+  }
+  if (bindings.empty())
+  {
+    ++m_n_local_bindings;
+  }
+  bindings.emplace(varname, std::move(binding));
+  return true;
+}
+
+void Workspace::UnbindLocalValues()
+{
+  std::lock_guard<std::mutex> lk(m_local_bindings_mutex);
+  if (m_local_bindings.erase(std::this_thread::get_id()) > 0)
+  {
+    --m_n_local_bindings;
+  }
+}
+
 bool Workspace::WaitForVariable(const std::string& name, double timeout_sec, bool availability)
 {
   auto it = m_var_map.find(name);
@@ -177,6 +474,35 @@ bool Workspace::WaitForVariable(const std::string& name, double timeout_sec, boo
   return it->second->IsAvailable() == availability;
 }
 
+void Workspace::RequestTick() const
+{
+  {
+    std::lock_guard<std::mutex> lk(m_tick_mutex);
+    m_tick_requested = true;
+  }
+  m_tick_cv.notify_all();
+}
+
+bool Workspace::WaitForTickRequest(sup::dto::int64 timeout_ns) const
+{
+  std::unique_lock<std::mutex> lk(m_tick_mutex);
+  auto result = m_tick_cv.wait_for(lk, std::chrono::nanoseconds(timeout_ns),
+                                   [this]{ return m_tick_requested; });
+  m_tick_requested = false;
+  return result;
+}
+
+ScopeGuard Workspace::ScheduleDeadline(std::chrono::steady_clock::time_point deadline,
+                                       std::function<void()> callback) const
+{
+  return m_timer->Schedule(deadline, std::move(callback));
+}
+
+void Workspace::SubmitWork(std::function<void()> task) const
+{
+  m_worker_pool->Submit(std::move(task));
+}
+
 std::vector<const Variable*> Workspace::GetVariables() const
 {
   std::vector<const Variable*> result;
@@ -217,6 +543,17 @@ const sup::dto::AnyTypeRegistry& Workspace::GetTypeRegistry() const
   return *m_type_registry;
 }
 
+bool Workspace::ParseType(const std::string& json_type, sup::dto::AnyType& anytype) const
+{
+  return m_type_cache->ParseType(json_type, anytype);
+}
+
+bool Workspace::ParseValue(const std::string& json_type, const std::string& json_value,
+                           sup::dto::AnyValue& anyvalue) const
+{
+  return m_type_cache->ParseValue(json_type, json_value, anyvalue);
+}
+
 ScopeGuard Workspace::GetCallbackGuard(void *listener)
 {
   return m_callbacks.GetCallbackGuard(listener);
@@ -233,6 +570,11 @@ bool Workspace::RegisterCallback(const std::string& name, const VariableCallback
   return m_callbacks.RegisterCallback(name, cb, listener);
 }
 
+bool Workspace::RegisterBatchCallback(const BatchCallback& cb, void* listener)
+{
+  return m_callbacks.RegisterBatchCallback(cb, listener);
+}
+
 bool Workspace::IsSuccessfullySetup() const
 {
   return m_setup_done;
@@ -250,33 +592,126 @@ bool Workspace::ContainsVariableName(const std::string& name) const
 std::vector<std::function<void()>> Workspace::ParseSetupTeardownActions(
     const std::vector<SetupTeardownActions>& actions)
 {
-  m_teardown_actions.clear();
-  std::set<std::string> setup_identifiers;
-  std::set<std::string> teardown_identifiers;
-  std::vector<std::function<void()>> setup_actions;
-  for (const auto& action : actions)
+  m_teardown_actions = UniqueActions(actions, &SetupTeardownActions::m_teardown);
+  return UniqueActions(actions, &SetupTeardownActions::m_setup);
+}
+
+std::vector<SetupTeardownActions> Workspace::GetVariableActions() const
+{
+  std::vector<SetupTeardownActions> result;
+  for (const auto& [name, actions] : m_variable_actions)
+  {
+    result.push_back(actions);
+  }
+  return result;
+}
+
+Workspace::Transaction* Workspace::GetTransaction() const
+{
+  if (m_n_transactions == 0)
+  {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lk(m_transactions_mutex);
+  auto it = m_transactions.find(std::this_thread::get_id());
+  if (it == m_transactions.end())
+  {
+    return nullptr;
+  }
+  return std::addressof(it->second);
+}
+
+sup::dto::AnyValue* Workspace::GetLocalBinding(const std::string& varname) const
+{
+  if (m_n_local_bindings == 0)
   {
-    if (action.m_identifier.empty())
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lk(m_local_bindings_mutex);
+  auto it = m_local_bindings.find(std::this_thread::get_id());
+  if (it == m_local_bindings.end())
+  {
+    return nullptr;
+  }
+  auto binding_it = it->second.find(varname);
+  if (binding_it == it->second.end())
+  {
+    return nullptr;
+  }
+  return std::addressof(binding_it->second);
+}
+
+sup::dto::AnyValue& Workspace::StageVariable(Transaction& transaction, const std::string& varname,
+                                             const Variable& var) const
+{
+  auto it = transaction.find(varname);
+  if (it == transaction.end())
+  {
+    StagedValue staged;
+    (void)var.GetValue(staged.m_original);
+    staged.m_value = staged.m_original;
+    it = transaction.emplace(varname, std::move(staged)).first;
+  }
+  return it->second.m_value;
+}
+
+bool Workspace::ApplyTransaction(const Transaction& transaction)
+{
+  // Transaction is ordered by variable name, which provides a consistent locking order.
+  std::vector<std::pair<Variable*, const StagedValue*>> writes;
+  std::vector<std::string> names;
+  for (const auto& [varname, staged] : transaction)
+  {
+    if (staged.m_value == staged.m_original)
     {
       continue;
     }
-
-    auto setup_iter =
-      std::find(setup_identifiers.begin(), setup_identifiers.end(), action.m_identifier);
-    auto teardown_iter =
-      std::find(teardown_identifiers.begin(), teardown_identifiers.end(), action.m_identifier);
-    if (action.m_setup && setup_iter == setup_identifiers.end())
+    writes.emplace_back(m_var_map.at(varname).get(), std::addressof(staged));
+    names.push_back(varname);
+  }
+  for (auto& [var, staged] : writes)
+  {
+    var->LockForTransaction();
+  }
+  bool success = true;
+  for (auto& [var, staged] : writes)
+  {
+    sup::dto::AnyValue current;
+    (void)var->GetValueInTransaction(current);
+    if (current != staged->m_original)
     {
-      setup_actions.push_back(action.m_setup);
-      setup_identifiers.insert(action.m_identifier);
+      success = false;
+      break;
     }
-    if (action.m_teardown && teardown_iter == teardown_identifiers.end())
+  }
+  std::size_t n_written = 0;
+  for (; success && n_written < writes.size(); ++n_written)
+  {
+    auto& [var, staged] = writes[n_written];
+    success = var->SetValueInTransaction(staged->m_value);
+  }
+  if (!success)
+  {
+    // Restore the variables that were already written (including the one that failed).
+    for (std::size_t idx = 0; idx < n_written; ++idx)
     {
-      m_teardown_actions.push_back(action.m_teardown);
-      teardown_identifiers.insert(action.m_identifier);
+      auto& [var, staged] = writes[idx];
+      (void)var->SetValueInTransaction(staged->m_original);
     }
   }
-  return setup_actions;
+  for (auto& [var, staged] : writes)
+  {
+    var->UnlockForTransaction();
+  }
+  for (auto& [var, staged] : writes)
+  {
+    var->FlushDeferredNotification(success);
+  }
+  if (success && !names.empty())
+  {
+    m_callbacks.ExecuteBatchCallbacks(names);
+  }
+  return success;
 }
 
 void Workspace::VariableUpdated(const std::string name, const sup::dto::AnyValue& value,
@@ -302,3 +737,59 @@ std::pair<std::string, std::string> SplitFieldName(const std::string& fullname)
 }  // namespace oac_tree
 
 }  // namespace sup
+
+namespace
+{
+bool GetStagedField(const sup::dto::AnyValue& staged, const std::string& fieldname,
+                    sup::dto::AnyValue& value)
+{
+  if (sup::dto::IsEmptyValue(staged))
+  {
+    return false;
+  }
+  if (!fieldname.empty() && !staged.HasField(fieldname))
+  {
+    return false;
+  }
+  const auto& src_value = fieldname.empty() ? staged : staged[fieldname];
+  return sup::dto::TryAssignIfEmptyOrConvert(value, src_value);
+}
+
+bool SetStagedField(sup::dto::AnyValue& staged, const std::string& fieldname,
+                    const sup::dto::AnyValue& value, bool dynamically_typed)
+{
+  // Check the type of whole values here with the assignment rules of the variable, so the write
+  // fails immediately instead of the commit of the transaction:
+  if (fieldname.empty())
+  {
+    return dynamically_typed ? sup::dto::TryAssign(staged, value)
+                             : sup::dto::TryAssignIfEmptyOrConvert(staged, value);
+  }
+  if (!staged.HasField(fieldname))
+  {
+    return false;
+  }
+  return sup::dto::TryAssign(staged[fieldname], value);
+}
+
+std::vector<std::function<void()>> UniqueActions(
+  const std::vector<sup::oac_tree::SetupTeardownActions>& actions, ActionMember member)
+{
+  std::set<std::string> identifiers;
+  std::vector<std::function<void()>> result;
+  for (const auto& action : actions)
+  {
+    const auto& func = action.*member;
+    if (action.m_identifier.empty() || !func)
+    {
+      continue;
+    }
+    if (identifiers.insert(action.m_identifier).second)
+    {
+      result.push_back(func);
+    }
+  }
+  return result;
+}
+
+}  // unnamed namespace
@@ -75,6 +75,17 @@ public:
    */
   void SetTickCallback(TickCallback cb = {});
 
+  /**
+   * @brief Set the maximum number of execution steps in a single tick of ExecuteProcedure().
+   * @param max_micro_ticks Maximum number of steps per tick (a value of zero is treated as one).
+   *
+   * @details With a value larger than one, a tick keeps executing steps as long as the procedure
+   * has not finished and does not report RUNNING (blocked), so synchronous subtrees run to
+   * completion without intermediate tick callbacks. Breakpoints and halt requests are still
+   * checked before each step. ExecuteSingle() always executes exactly one step.
+   */
+  void SetMaxMicroTicks(sup::dto::uint32 max_micro_ticks);
+
   /**
    * @brief Set a breakpoint at the given instruction.
    * @param instruction Pointer to instruction for breakpoint location.
@@ -158,18 +169,41 @@ public:
 private:
   bool InstructionPresent(const Instruction* instruction) const;
 
+  /**
+   * @brief Check the breakpoints of the instructions that will be executed next.
+   *
+   * @return true when a breakpoint was triggered and execution should pause.
+   */
+  bool HandleBreakpoints();
+
+  /**
+   * @brief Execute one step of the procedure, without calling the tick callback.
+   */
+  void ExecuteStep();
+
+  /**
+   * @brief Check if another step can be executed in the current tick.
+   */
+  bool CanContinueTick() const;
+
+  void CallTickCallback();
+
   Procedure* m_proc;
   UserInterface& m_ui;
   ScopeGuard m_cb_guard;
   TickCallback m_tick_cb;
   std::unique_ptr<BreakpointManager> m_breakpoint_manager;
   std::vector<const Instruction*> m_current_breakpoint_instructions;
+  sup::dto::uint32 m_max_micro_ticks;
   std::atomic_bool m_halt;
 };
 
 /**
  * @brief Class that can be used as a callback in between ticks. It will perform a fixed timeout
  * when the procedure reports a running status (async operation).
+ *
+ * @note The timeout ends early when an instruction requests a tick through the workspace (see
+ * Workspace::RequestTick).
  */
 class TimeoutWhenRunning
 {
@@ -282,10 +282,12 @@ void AsyncRunner::ExecutionLoop()
 void AsyncRunner::RunProcedure()
 {
   const TimeoutWhenRunning timeout{TickTimeoutNs(m_proc)};
+  m_runner.SetMaxMicroTicks(MaxMicroTicks(m_proc));
   auto tick_callback = [this, &timeout](const Procedure& proc){
+    // Report the tick before a possible state switch on finishing:
+    m_state_monitor.OnProcedureTick(proc);
     ProcessCommandsWhenRunning();
     timeout(proc);
-    m_state_monitor.OnProcedureTick(proc);
     return;
   };
   m_runner.SetTickCallback(tick_callback);
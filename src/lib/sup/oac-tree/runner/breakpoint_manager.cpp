@@ -129,6 +129,12 @@ std::list<Breakpoint> BreakpointManager::GetBreakpoints() const
   return m_breakpoints;
 }
 
+bool BreakpointManager::HasBreakpoints() const
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return !m_breakpoints.empty();
+}
+
 bool BreakpointManager::IsKnownInstruction(const Instruction* instruction) const
 {
   auto iter = m_instruction_list.find(instruction);
@@ -100,6 +100,11 @@ public:
    */
   std::list<Breakpoint> GetBreakpoints() const;
 
+  /**
+   * @brief Check if any breakpoints are managed.
+   */
+  bool HasBreakpoints() const;
+
 private:
   /**
    * @brief Check if the given instruction is known, i.e. it is a valid instruction for a
@@ -29,6 +29,11 @@ namespace oac_tree
 
 IJobInfoIO::~IJobInfoIO() = default;
 
+sup::dto::uint32 IJobInfoIO::GetMaxConcurrentUserInputs() const
+{
+  return 1;
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
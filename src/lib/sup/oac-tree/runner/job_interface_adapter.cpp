@@ -44,7 +44,8 @@ JobInterfaceAdapter::JobInterfaceAdapter(const Procedure& proc, IJobInfoIO& job_
   , m_instr_states{}
   , m_job_info_io{job_info_io}
   , m_input_adapter{std::bind(&ForwardUserInput, std::ref(m_job_info_io), _1, _2),
-                    std::bind(&ForwardInterrupt, std::ref(m_job_info_io), _1)}
+                    std::bind(&ForwardInterrupt, std::ref(m_job_info_io), _1),
+                    job_info_io.GetMaxConcurrentUserInputs()}
 {}
 
 JobInterfaceAdapter::~JobInterfaceAdapter() = default;
@@ -24,15 +24,15 @@
 
 #include "breakpoint_manager.h"
 
+#include <sup/oac-tree/constants.h>
 #include <sup/oac-tree/exceptions.h>
 #include <sup/oac-tree/instruction.h>
 #include <sup/oac-tree/instruction_tree.h>
 #include <sup/oac-tree/procedure.h>
 #include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
 
 #include <algorithm>
-#include <chrono>
-#include <thread>
 
 namespace sup
 {
@@ -46,6 +46,7 @@ Runner::Runner(UserInterface& ui)
   , m_tick_cb{}
   , m_breakpoint_manager{new BreakpointManager{}}
   , m_current_breakpoint_instructions{}
+  , m_max_micro_ticks{DefaultSettings::DEFAULT_MAX_MICRO_TICKS}
   , m_halt{false}
 {}
 
@@ -69,6 +70,11 @@ void Runner::SetTickCallback(TickCallback cb)
   m_tick_cb = cb;
 }
 
+void Runner::SetMaxMicroTicks(sup::dto::uint32 max_micro_ticks)
+{
+  m_max_micro_ticks = std::max(max_micro_ticks, sup::dto::uint32{1});
+}
+
 bool Runner::SetBreakpoint(const Instruction* instruction)
 {
   return m_breakpoint_manager->SetBreakpoint(instruction);
@@ -94,16 +100,22 @@ void Runner::ExecuteProcedure()
   }
   while (!IsFinished() && !m_halt.load())
   {
-    auto next_instructions = GetNextInstructions(*m_proc);
-    if (!next_instructions.empty())
+    if (HandleBreakpoints())
     {
-      m_current_breakpoint_instructions = m_breakpoint_manager->HandleBreakpoints(next_instructions);
-      if (!m_current_breakpoint_instructions.empty())
+      return;
+    }
+    ExecuteStep();
+    // Run to block: keep executing steps within this tick while the procedure is not blocked.
+    for (sup::dto::uint32 i = 1; i < m_max_micro_ticks && CanContinueTick(); ++i)
+    {
+      if (HandleBreakpoints())
       {
+        CallTickCallback();
         return;
       }
+      ExecuteStep();
     }
-    ExecuteSingle();
+    CallTickCallback();
   }
 }
 
@@ -111,12 +123,8 @@ void Runner::ExecuteSingle()
 {
   if (m_proc)
   {
-    m_proc->ExecuteSingle(m_ui);
-    m_breakpoint_manager->ResetBreakpoints();
-    if (m_tick_cb)
-    {
-      m_tick_cb(*m_proc);
-    }
+    ExecuteStep();
+    CallTickCallback();
   }
 }
 
@@ -185,6 +193,41 @@ bool Runner::InstructionPresent(const Instruction* instruction) const
   return found_it != instructions.end();
 }
 
+bool Runner::HandleBreakpoints()
+{
+  if (!m_breakpoint_manager->HasBreakpoints())
+  {
+    m_current_breakpoint_instructions.clear();
+    return false;
+  }
+  auto next_instructions = GetNextInstructions(*m_proc);
+  if (next_instructions.empty())
+  {
+    return false;
+  }
+  m_current_breakpoint_instructions = m_breakpoint_manager->HandleBreakpoints(next_instructions);
+  return !m_current_breakpoint_instructions.empty();
+}
+
+void Runner::ExecuteStep()
+{
+  m_proc->ExecuteSingle(m_ui);
+  m_breakpoint_manager->ResetBreakpoints();
+}
+
+bool Runner::CanContinueTick() const
+{
+  return m_proc->GetStatus() == ExecutionStatus::NOT_FINISHED && !m_halt.load() && !IsFinished();
+}
+
+void Runner::CallTickCallback()
+{
+  if (m_tick_cb)
+  {
+    m_tick_cb(*m_proc);
+  }
+}
+
 TimeoutWhenRunning::TimeoutWhenRunning(sup::dto::int64 ns)
   : m_timeout_ns{ns}
 {}
@@ -195,7 +238,7 @@ void TimeoutWhenRunning::operator()(const Procedure& proc) const
 {
   if (proc.GetStatus() == ExecutionStatus::RUNNING && m_timeout_ns > 0)
   {
-    std::this_thread::sleep_for(std::chrono::nanoseconds(m_timeout_ns));
+    (void)proc.GetWorkspace().WaitForTickRequest(m_timeout_ns);
   }
 }
 
@@ -28,9 +28,12 @@
 
 #include <sup/dto/anyvalue.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <utility>
 
 namespace sup
 {
@@ -47,15 +50,21 @@ namespace oac_tree
  * @details Most of the Variable API is implemented using the non-virtual interface (NVI) idiom and
  * locks are provided for those public methods that can be called during execution to ensure
  * thread safety. Those methods are:
- *   - Value access functions: GetValue, SetValue and IsAvailable;
- *   - Notification callback functions: Notify and SetNotifyCallback.
+ *   - Value access functions: GetValue, SetValue, UpdateValue, UpdateValueInPlace, CompareAndSwap
+ *     and IsAvailable;
+ *   - Notification callback functions: Notify and SetNotifyCallback;
+ *   - Transaction functions: LockForTransaction, GetValueInTransaction, SetValueInTransaction,
+ *     UnlockForTransaction and FlushDeferredNotification.
  * Note that all other methods are not thread safe and thus should be called only from a single
  * thread. These methods are typically called during the initialization of a procedure.
+ * Implementations that can safely read their value concurrently with writes may opt out of the
+ * locking on the read path by overriding SupportsConcurrentReads.
  */
 class Variable
 {
 public:
   using Callback = std::function<void(const sup::dto::AnyValue&, bool)>;
+  using UpdateFunction = std::function<bool(sup::dto::AnyValue&)>;
 
   Variable(const std::string& type);
 
@@ -104,6 +113,27 @@ public:
    */
   void Reset(const Workspace& ws);
 
+  /**
+   * @brief Indicate if Reset restores the variable in place, i.e. without calling Teardown and
+   * Setup.
+   *
+   * @details Variables that are not reset in place may rely on global setup and teardown actions
+   * (see SetupTeardownActions), so a workspace reset runs those actions again for them.
+   *
+   * @return true if the variable is reset in place.
+   */
+  bool HasInPlaceReset() const;
+
+  /**
+   * @brief Indicate if a write of a whole value may change the type of the variable.
+   *
+   * @details Writes that are staged outside of the variable (see Workspace::BeginTransaction) use
+   * this to apply the same assignment rules as the variable itself.
+   *
+   * @return true if the variable is dynamically typed.
+   */
+  bool IsDynamicallyTyped() const;
+
   /**
    * @brief Get value of variable.
    *
@@ -116,6 +146,17 @@ public:
    */
   bool GetValue(sup::dto::AnyValue& value, const std::string& fieldname = {}) const;
 
+  /**
+   * @brief Get a read-only snapshot of the value of the variable.
+   *
+   * @return Shared pointer to the value or nullptr on failure.
+   *
+   * @note Non-virtual interface. The snapshot is not affected by later writes to the variable.
+   * Implementations that already store their value as an immutable object can share it without
+   * copying.
+   */
+  std::shared_ptr<const sup::dto::AnyValue> GetSnapshot() const;
+
   /**
    * @brief Set value of variable.
    *
@@ -128,6 +169,47 @@ public:
    */
   bool SetValue(const sup::dto::AnyValue& value, const std::string& fieldname = {});
 
+  /**
+   * @brief Atomically update the value of the variable.
+   *
+   * @param func Function that modifies the value passed to it and returns true on success.
+   * @param fieldname optional field name.
+   * @return true on success.
+   *
+   * @note Non-virtual interface. Reading the current value, applying the function and writing
+   * back the result happen under a single lock acquisition, so concurrent updates cannot be lost.
+   * The result is written with the same semantics as SetValue. If the function returns false,
+   * nothing is written.
+   */
+  bool UpdateValue(const UpdateFunction& func, const std::string& fieldname = {});
+
+  /**
+   * @brief Atomically update the stored value of the variable in place, without copying it.
+   *
+   * @param func Function that modifies the value passed to it and returns true on success. It
+   * may only modify the value when it returns true.
+   * @param fieldname optional field name.
+   * @return true on success.
+   *
+   * @note Non-virtual interface. Use this for incremental changes to large values, e.g. appending
+   * to an array. Listeners are notified once. Variable implementations that cannot update their
+   * value in place fall back to the semantics of UpdateValue.
+   */
+  bool UpdateValueInPlace(const UpdateFunction& func, const std::string& fieldname = {});
+
+  /**
+   * @brief Atomically replace the value of the variable if it equals the expected value.
+   *
+   * @param expected Value to compare the current value to.
+   * @param desired Value to write when the comparison succeeds.
+   * @param fieldname optional field name.
+   * @return true if the current value was equal to the expected one and was replaced.
+   *
+   * @note Non-virtual interface.
+   */
+  bool CompareAndSwap(const sup::dto::AnyValue& expected, const sup::dto::AnyValue& desired,
+                      const std::string& fieldname = {});
+
   /**
    * @brief Check if variable is available.
    *
@@ -160,6 +242,48 @@ public:
    */
   void SetNotifyCallback(Callback func);
 
+  /**
+   * @brief Lock the variable as part of a multi-variable transaction.
+   *
+   * @details This acquires the access mutex and defers update notifications until
+   * FlushDeferredNotification is called. While locked, the calling thread can only access the value
+   * through GetValueInTransaction and SetValueInTransaction.
+   *
+   * @note Used by Workspace to apply a set of writes atomically. Multiple variables need to be
+   * locked in a consistent order to avoid deadlock.
+   */
+  void LockForTransaction();
+
+  /**
+   * @brief Get the full value of a variable that was locked with LockForTransaction.
+   *
+   * @param value Output parameter for the value.
+   * @return true on success.
+   */
+  bool GetValueInTransaction(sup::dto::AnyValue& value) const;
+
+  /**
+   * @brief Set the full value of a variable that was locked with LockForTransaction.
+   *
+   * @param value Value to set.
+   * @return true on success.
+   */
+  bool SetValueInTransaction(const sup::dto::AnyValue& value);
+
+  /**
+   * @brief Release the access mutex that was acquired by LockForTransaction.
+   *
+   * @note Notifications remain deferred until FlushDeferredNotification is called.
+   */
+  void UnlockForTransaction();
+
+  /**
+   * @brief Stop deferring notifications and send the last deferred one (if any).
+   *
+   * @param send If false, the deferred notification is discarded instead (e.g. after a rollback).
+   */
+  void FlushDeferredNotification(bool send);
+
   /**
    * @brief Tear down the variable.
    * @details This method resets the variable to its initial, i.e. uninitialized, state. For
@@ -254,6 +378,13 @@ protected:
    */
   void AddConstraint(Constraint constraint);
 
+  /**
+   * @brief Implementation of UpdateValue, without taking the access mutex.
+   *
+   * @note Copies the value, applies the function and writes the result with SetValueImpl.
+   */
+  bool UpdateValueUnlocked(const UpdateFunction& func, const std::string& fieldname);
+
 private:
   /**
    * @brief Typename of this variable
@@ -267,8 +398,11 @@ private:
 
   /**
    * @brief Indicates if the Variable was correctly setup from its attributes.
+   *
+   * @note This flag is atomic, since it can be read without holding the access mutex (see
+   * SupportsConcurrentReads).
    */
-  bool m_setup_successful;
+  std::atomic<bool> m_setup_successful;
 
   /**
    * @brief Mutex for concurrent access of Variable.
@@ -300,6 +434,25 @@ private:
    */
   Callback m_notify_cb;
 
+  /**
+   * @brief Indicates that notifications are deferred because of an ongoing transaction.
+   *
+   * @note Protected by the notify mutex.
+   */
+  mutable bool m_notify_deferred;
+
+  /**
+   * @brief Last notification that was deferred, if any.
+   *
+   * @note Protected by the notify mutex.
+   */
+  mutable std::unique_ptr<std::pair<sup::dto::AnyValue, bool>> m_deferred_notification;
+
+  /**
+   * @brief Implementation of GetValue, without taking the access mutex.
+   */
+  bool GetValueUnlocked(sup::dto::AnyValue& value, const std::string& fieldname) const;
+
   /**
    * @brief Get value of variable.
    *
@@ -310,6 +463,16 @@ private:
    */
   virtual bool GetValueImpl(sup::dto::AnyValue& value) const = 0;
 
+  /**
+   * @brief Get a read-only snapshot of the value of the variable.
+   *
+   * @return Shared pointer to the value or nullptr on failure.
+   *
+   * @note Private virtual implementation. The default implementation copies the value obtained
+   * from GetValueImpl.
+   */
+  virtual std::shared_ptr<const sup::dto::AnyValue> GetSnapshotImpl() const;
+
   /**
    * @brief Set value of variable.
    *
@@ -320,6 +483,29 @@ private:
    */
   virtual bool SetValueImpl(const sup::dto::AnyValue& value) = 0;
 
+  /**
+   * @brief Update the stored value in place.
+   *
+   * @param func Function that modifies the value and returns true on success.
+   * @param fieldname optional field name.
+   * @return true on success.
+   *
+   * @note Private virtual implementation, called while holding the access mutex. The default
+   * implementation copies the value, applies the function and writes it back with SetValueImpl.
+   */
+  virtual bool UpdateValueInPlaceImpl(const UpdateFunction& func, const std::string& fieldname);
+
+  /**
+   * @brief Indicate if GetValueImpl can be called concurrently with other calls to GetValueImpl
+   * and SetValueImpl.
+   *
+   * @return true if GetValue does not need to take the access mutex.
+   *
+   * @note Private virtual implementation. The default implementation returns false. Writes are
+   * always serialized, independent of the returned value.
+   */
+  virtual bool SupportsConcurrentReads() const;
+
   /**
    * @brief Check if variable is available.
    *
@@ -355,6 +541,21 @@ private:
    */
   virtual void ResetImpl(const Workspace& ws);
 
+  /**
+   * @brief Indicate if ResetImpl restores the variable without calling Teardown and Setup.
+   *
+   * @note Private virtual implementation. The default implementation returns false and needs to
+   * be overridden together with ResetImpl.
+   */
+  virtual bool HasInPlaceResetImpl() const;
+
+  /**
+   * @brief Indicate if a write of a whole value may change the type of the variable.
+   *
+   * @note Private virtual implementation. The default implementation returns false.
+   */
+  virtual bool IsDynamicallyTypedImpl() const;
+
   /**
    * @brief Tear down the variable.
    *
@@ -391,6 +592,27 @@ sup::dto::AnyValue ParseAnyValueAttributePair(const Variable& variable,
                                               const std::string& value_attr_name,
                                               const sup::dto::AnyTypeRegistry& registry);
 
+/**
+ * @brief Construct an anyvalue from a set of attributes holding the json type and value
+ * representation, using the workspace's type registry.
+ *
+ * @param variable Variable to use.
+ * @param type_attr_name Attribute name for the json type.
+ * @param value_attr_name Attribute name for the json value.
+ * @param ws Workspace whose type registry and parse cache are used.
+ *
+ * @return AnyValue created from parsing the set of attributes. If the json type attribute is not
+ * present, returns empty. If the json value attribute is not present, returns a default constructed
+ * value from the type.
+ * @throws VariableSetupException when the parsing fails.
+ *
+ * @note Identical type and value strings are only parsed once per workspace.
+ */
+sup::dto::AnyValue ParseAnyValueAttributePair(const Variable& variable,
+                                              const std::string& type_attr_name,
+                                              const std::string& value_attr_name,
+                                              const Workspace& ws);
+
 }  // namespace oac_tree
 
 }  // namespace sup
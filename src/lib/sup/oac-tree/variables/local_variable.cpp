@@ -44,10 +44,14 @@ const std::string LocalVariable::Type = "Local";
 LocalVariable::LocalVariable()
   : Variable(LocalVariable::Type)
   , m_value{}
+  , m_snapshot{}
+  , m_read_mostly{false}
+  , m_initial_value{}
 {
   AddAttributeDefinition(Constants::TYPE_ATTRIBUTE_NAME, sup::dto::StringType);
   AddAttributeDefinition(Constants::VALUE_ATTRIBUTE_NAME, sup::dto::StringType);
   AddAttributeDefinition(Constants::IS_DYNAMIC_TYPE_ATTRIBUTE_NAME, sup::dto::BooleanType);
+  AddAttributeDefinition(Constants::READ_MOSTLY_ATTRIBUTE_NAME, sup::dto::BooleanType);
   AddConstraint(MakeConstraint<Or>(
                   MakeConstraint<Exists>(Constants::TYPE_ATTRIBUTE_NAME),
                   MakeConstraint<Not>(MakeConstraint<Exists>(Constants::VALUE_ATTRIBUTE_NAME))));
@@ -55,7 +59,7 @@ LocalVariable::LocalVariable()
 
 LocalVariable::~LocalVariable() {}
 
-bool LocalVariable::IsDynamicallyTyped() const
+bool LocalVariable::IsDynamicallyTypedImpl() const
 {
   bool is_dynamic = false;
   if (!GetAttributeValue(Constants::IS_DYNAMIC_TYPE_ATTRIBUTE_NAME, is_dynamic))
@@ -65,8 +69,26 @@ bool LocalVariable::IsDynamicallyTyped() const
   return is_dynamic;
 }
 
+bool LocalVariable::AssignValue(sup::dto::AnyValue& dest, const sup::dto::AnyValue& src) const
+{
+  if (IsDynamicallyTyped())
+  {
+    return sup::dto::TryAssign(dest, src);
+  }
+  return sup::dto::TryAssignIfEmptyOrConvert(dest, src);
+}
+
 bool LocalVariable::GetValueImpl(sup::dto::AnyValue& value) const
 {
+  if (m_read_mostly)
+  {
+    auto snapshot = std::atomic_load(&m_snapshot);
+    if (!snapshot || sup::dto::IsEmptyValue(*snapshot))
+    {
+      return false;
+    }
+    return sup::dto::TryAssign(value, *snapshot);
+  }
   if (sup::dto::IsEmptyValue(m_value))
   {
     return false;
@@ -74,17 +96,42 @@ bool LocalVariable::GetValueImpl(sup::dto::AnyValue& value) const
   return sup::dto::TryAssign(value, m_value);
 }
 
-bool LocalVariable::SetValueImpl(const sup::dto::AnyValue& value)
+std::shared_ptr<const sup::dto::AnyValue> LocalVariable::GetSnapshotImpl() const
 {
-  bool result = false;
-  if (IsDynamicallyTyped())
+  if (m_read_mostly)
   {
-    result = sup::dto::TryAssign(m_value, value);
+    auto snapshot = std::atomic_load(&m_snapshot);
+    if (!snapshot || sup::dto::IsEmptyValue(*snapshot))
+    {
+      return nullptr;
+    }
+    return snapshot;
   }
-  else
+  if (sup::dto::IsEmptyValue(m_value))
   {
-    result = sup::dto::TryAssignIfEmptyOrConvert(m_value, value);
+    return nullptr;
   }
+  return std::make_shared<const sup::dto::AnyValue>(m_value);
+}
+
+bool LocalVariable::SetValueImpl(const sup::dto::AnyValue& value)
+{
+  if (m_read_mostly)
+  {
+    // Writers are serialized by the access mutex, so the snapshot cannot change in between.
+    auto snapshot = std::atomic_load(&m_snapshot);
+    auto new_value = snapshot ? *snapshot : sup::dto::AnyValue{};
+    if (!AssignValue(new_value, value))
+    {
+      return false;
+    }
+    std::atomic_store(&m_snapshot,
+                      std::shared_ptr<const sup::dto::AnyValue>(
+                        std::make_shared<sup::dto::AnyValue>(std::move(new_value))));
+    Notify(value, true);
+    return true;
+  }
+  bool result = AssignValue(m_value, value);
   if (result)
   {
     Notify(value, true);
@@ -92,17 +139,75 @@ bool LocalVariable::SetValueImpl(const sup::dto::AnyValue& value)
   return result;
 }
 
-SetupTeardownActions LocalVariable::SetupImpl(const Workspace& ws)
+bool LocalVariable::UpdateValueInPlaceImpl(const UpdateFunction& func,
+                                           const std::string& fieldname)
 {
-  m_value = ParseAnyValueAttributePair(
-    *this, Constants::TYPE_ATTRIBUTE_NAME, Constants::VALUE_ATTRIBUTE_NAME, ws.GetTypeRegistry());
+  // Snapshots of read-mostly variables are immutable and a type change of a field or of a
+  // statically typed variable is not allowed, so these updates go through a copy.
+  if (m_read_mostly || !fieldname.empty() || !IsDynamicallyTyped())
+  {
+    return UpdateValueUnlocked(func, fieldname);
+  }
+  if (sup::dto::IsEmptyValue(m_value) || !func(m_value))
+  {
+    return false;
+  }
   Notify(m_value, true);
+  return true;
+}
+
+bool LocalVariable::SupportsConcurrentReads() const
+{
+  return m_read_mostly;
+}
+
+SetupTeardownActions LocalVariable::SetupImpl(const Workspace& ws)
+{
+  m_initial_value = std::make_shared<const sup::dto::AnyValue>(ParseAnyValueAttributePair(
+    *this, Constants::TYPE_ATTRIBUTE_NAME, Constants::VALUE_ATTRIBUTE_NAME, ws));
+  bool read_mostly = false;
+  m_read_mostly = GetAttributeValue(Constants::READ_MOSTLY_ATTRIBUTE_NAME, read_mostly)
+                  && read_mostly;
+  RestoreInitialValue();
   return {};
 }
 
+void LocalVariable::ResetImpl(const Workspace& ws)
+{
+  if (!m_initial_value)
+  {
+    Teardown();
+    Setup(ws);
+    return;
+  }
+  RestoreInitialValue();
+}
+
+bool LocalVariable::HasInPlaceResetImpl() const
+{
+  return true;
+}
+
 void LocalVariable::TeardownImpl()
 {
   m_value = sup::dto::AnyValue{};
+  std::atomic_store(&m_snapshot, std::shared_ptr<const sup::dto::AnyValue>{});
+  m_initial_value.reset();
+  m_read_mostly = false;
+}
+
+void LocalVariable::RestoreInitialValue()
+{
+  if (m_read_mostly)
+  {
+    // The initial value is immutable, so it can be shared as the current snapshot.
+    std::atomic_store(&m_snapshot, m_initial_value);
+  }
+  else
+  {
+    m_value = *m_initial_value;
+  }
+  Notify(*m_initial_value, true);
 }
 
 }  // namespace oac_tree
@@ -25,6 +25,9 @@
 
 #include <sup/oac-tree/variable.h>
 
+#include <atomic>
+#include <memory>
+
 namespace sup
 {
 namespace oac_tree
@@ -34,6 +37,12 @@ namespace oac_tree
  *
  * @details A LocalVariable with only a type attribute (no value attribute) will
  * allocate a zero-initialized AnyValue with the given type.
+ *
+ * The value parsed during Setup is kept, so Reset restores it without parsing the attributes again.
+ *
+ * When the 'readMostly' attribute is set, the value is stored as an immutable snapshot that is
+ * replaced atomically on each write. Readers then only copy the current snapshot and do not block
+ * writers or each other.
  */
 class LocalVariable : public Variable
 {
@@ -52,14 +61,41 @@ private:
    */
   sup::dto::AnyValue m_value;
 
-  bool IsDynamicallyTyped() const;
+  /**
+   * @brief Encapsulated AnyValue in read-mostly mode.
+   *
+   * @note Only accessed through std::atomic_load/std::atomic_store.
+   */
+  std::shared_ptr<const sup::dto::AnyValue> m_snapshot;
+
+  /**
+   * @brief Read-mostly mode flag, set during Setup.
+   *
+   * @note Atomic, since it is also read without the lock (see SupportsConcurrentReads).
+   */
+  std::atomic<bool> m_read_mostly;
+
+  /**
+   * @brief Value parsed during Setup, used to reset the variable without parsing again.
+   */
+  std::shared_ptr<const sup::dto::AnyValue> m_initial_value;
+
+  bool AssignValue(sup::dto::AnyValue& dest, const sup::dto::AnyValue& src) const;
+
+  void RestoreInitialValue();
 
   /**
    * @brief See sup::oac_tree::Variable.
    */
   bool GetValueImpl(sup::dto::AnyValue& value) const override;
+  std::shared_ptr<const sup::dto::AnyValue> GetSnapshotImpl() const override;
   bool SetValueImpl(const sup::dto::AnyValue& value) override;
+  bool UpdateValueInPlaceImpl(const UpdateFunction& func, const std::string& fieldname) override;
+  bool SupportsConcurrentReads() const override;
   SetupTeardownActions SetupImpl(const Workspace& ws) override;
+  void ResetImpl(const Workspace& ws) override;
+  bool HasInPlaceResetImpl() const override;
+  bool IsDynamicallyTypedImpl() const override;
   void TeardownImpl() override;
 };
 
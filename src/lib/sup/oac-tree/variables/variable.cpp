@@ -53,6 +53,8 @@ Variable::Variable(const std::string &type)
   , m_notify_mutex{}
   , m_update_cond{}
   , m_notify_cb{}
+  , m_notify_deferred{false}
+  , m_deferred_notification{}
 {
   AddAttributeDefinition(Constants::NAME_ATTRIBUTE_NAME, sup::dto::StringType);
 }
@@ -92,9 +94,28 @@ void Variable::Reset(const Workspace& ws)
   return ResetImpl(ws);
 }
 
+bool Variable::HasInPlaceReset() const
+{
+  return HasInPlaceResetImpl();
+}
+
+bool Variable::IsDynamicallyTyped() const
+{
+  return IsDynamicallyTypedImpl();
+}
+
 bool Variable::GetValue(sup::dto::AnyValue& value, const std::string& fieldname) const
 {
+  if (SupportsConcurrentReads())
+  {
+    return GetValueUnlocked(value, fieldname);
+  }
   std::lock_guard<std::mutex> lock(m_access_mutex);
+  return GetValueUnlocked(value, fieldname);
+}
+
+bool Variable::GetValueUnlocked(sup::dto::AnyValue& value, const std::string& fieldname) const
+{
   if (!m_setup_successful)
   {
     return false;
@@ -112,6 +133,16 @@ bool Variable::GetValue(sup::dto::AnyValue& value, const std::string& fieldname)
   return sup::dto::TryAssignIfEmptyOrConvert(value, src_value);
 }
 
+std::shared_ptr<const sup::dto::AnyValue> Variable::GetSnapshot() const
+{
+  if (SupportsConcurrentReads())
+  {
+    return m_setup_successful ? GetSnapshotImpl() : nullptr;
+  }
+  std::lock_guard<std::mutex> lock(m_access_mutex);
+  return m_setup_successful ? GetSnapshotImpl() : nullptr;
+}
+
 bool Variable::SetValue(const sup::dto::AnyValue& value, const std::string& fieldname)
 {
   std::lock_guard<std::mutex> lk(m_access_mutex);
@@ -139,6 +170,72 @@ bool Variable::SetValue(const sup::dto::AnyValue& value, const std::string& fiel
   return SetValueImpl(var_copy);
 }
 
+bool Variable::UpdateValue(const UpdateFunction& func, const std::string& fieldname)
+{
+  std::lock_guard<std::mutex> lk(m_access_mutex);
+  if (!m_setup_successful)
+  {
+    return false;
+  }
+  return UpdateValueUnlocked(func, fieldname);
+}
+
+bool Variable::UpdateValueInPlace(const UpdateFunction& func, const std::string& fieldname)
+{
+  std::lock_guard<std::mutex> lk(m_access_mutex);
+  if (!m_setup_successful)
+  {
+    return false;
+  }
+  return UpdateValueInPlaceImpl(func, fieldname);
+}
+
+bool Variable::UpdateValueUnlocked(const UpdateFunction& func, const std::string& fieldname)
+{
+  sup::dto::AnyValue var_copy;
+  if (!GetValueImpl(var_copy))
+  {
+    return false;
+  }
+  if (fieldname.empty())
+  {
+    if (!func(var_copy))
+    {
+      return false;
+    }
+    return SetValueImpl(var_copy);
+  }
+  if (!var_copy.HasField(fieldname))
+  {
+    return false;
+  }
+  sup::dto::AnyValue field_copy = var_copy[fieldname];
+  if (!func(field_copy))
+  {
+    return false;
+  }
+  if (!sup::dto::TryAssign(var_copy[fieldname], field_copy))
+  {
+    return false;
+  }
+  return SetValueImpl(var_copy);
+}
+
+bool Variable::CompareAndSwap(const sup::dto::AnyValue& expected,
+                              const sup::dto::AnyValue& desired, const std::string& fieldname)
+{
+  auto func = [&expected, &desired](sup::dto::AnyValue& value)
+  {
+    if (value != expected)
+    {
+      return false;
+    }
+    value = desired;
+    return true;
+  };
+  return UpdateValue(func, fieldname);
+}
+
 bool Variable::IsAvailable() const
 {
   std::lock_guard<std::mutex> lk(m_access_mutex);
@@ -152,6 +249,12 @@ bool Variable::IsAvailable() const
 void Variable::Notify(const sup::dto::AnyValue& value, bool connected) const
 {
   std::lock_guard<std::mutex> lk(m_notify_mutex);
+  if (m_notify_deferred)
+  {
+    m_deferred_notification = std::make_unique<std::pair<sup::dto::AnyValue, bool>>(value,
+                                                                                    connected);
+    return;
+  }
   if (m_notify_cb)
   {
     m_notify_cb(value, connected);
@@ -164,6 +267,46 @@ void Variable::SetNotifyCallback(Callback func)
   m_notify_cb = std::move(func);
 }
 
+void Variable::LockForTransaction()
+{
+  m_access_mutex.lock();
+  std::lock_guard<std::mutex> lk(m_notify_mutex);
+  m_notify_deferred = true;
+}
+
+bool Variable::GetValueInTransaction(sup::dto::AnyValue& value) const
+{
+  return GetValueUnlocked(value, {});
+}
+
+bool Variable::SetValueInTransaction(const sup::dto::AnyValue& value)
+{
+  if (!m_setup_successful)
+  {
+    return false;
+  }
+  return SetValueImpl(value);
+}
+
+void Variable::UnlockForTransaction()
+{
+  m_access_mutex.unlock();
+}
+
+void Variable::FlushDeferredNotification(bool send)
+{
+  std::unique_ptr<std::pair<sup::dto::AnyValue, bool>> notification;
+  {
+    std::lock_guard<std::mutex> lk(m_notify_mutex);
+    m_notify_deferred = false;
+    notification = std::move(m_deferred_notification);
+  }
+  if (send && notification)
+  {
+    Notify(notification->first, notification->second);
+  }
+}
+
 void Variable::Teardown()
 {
   TeardownImpl();
@@ -223,6 +366,26 @@ bool Variable::IsAvailableImpl() const
   return true;
 }
 
+std::shared_ptr<const sup::dto::AnyValue> Variable::GetSnapshotImpl() const
+{
+  auto value = std::make_shared<sup::dto::AnyValue>();
+  if (!GetValueImpl(*value))
+  {
+    return nullptr;
+  }
+  return value;
+}
+
+bool Variable::UpdateValueInPlaceImpl(const UpdateFunction& func, const std::string& fieldname)
+{
+  return UpdateValueUnlocked(func, fieldname);
+}
+
+bool Variable::SupportsConcurrentReads() const
+{
+  return false;
+}
+
 SetupTeardownActions Variable::SetupImpl(const Workspace&)
 {
   return {};
@@ -234,6 +397,16 @@ void Variable::ResetImpl(const Workspace& ws)
   Setup(ws);
 }
 
+bool Variable::HasInPlaceResetImpl() const
+{
+  return false;
+}
+
+bool Variable::IsDynamicallyTypedImpl() const
+{
+  return false;
+}
+
 void Variable::TeardownImpl()
 {}
 
@@ -279,6 +452,40 @@ sup::dto::AnyValue ParseAnyValueAttributePair(const Variable& variable,
   return sup::dto::AnyValue(parsed_type);
 }
 
+sup::dto::AnyValue ParseAnyValueAttributePair(const Variable& variable,
+                                              const std::string& type_attr_name,
+                                              const std::string& value_attr_name,
+                                              const Workspace& ws)
+{
+  if (!variable.HasAttribute(type_attr_name))
+  {
+    return {};
+  }
+  auto type_str = variable.GetAttributeString(type_attr_name);
+  sup::dto::AnyType parsed_type;
+  if (!ws.ParseType(type_str, parsed_type))
+  {
+    std::string error_message = VariableSetupExceptionProlog(variable) +
+      "could not parse attribute [" + type_attr_name + "] with value [" + type_str + "] to an "
+      "AnyType";
+    throw VariableSetupException(error_message);
+  }
+  if (variable.HasAttribute(value_attr_name))
+  {
+    auto val_str = variable.GetAttributeString(value_attr_name);
+    sup::dto::AnyValue result;
+    if (!ws.ParseValue(type_str, val_str, result))
+    {
+      std::string error_message = VariableSetupExceptionProlog(variable) +
+        "could not parse attribute [" + value_attr_name + "] with value [" + val_str + "] to an "
+        "AnyValue";
+      throw VariableSetupException(error_message);
+    }
+    return result;
+  }
+  return sup::dto::AnyValue(parsed_type);
+}
+
 }  // namespace oac_tree
 
 }  // namespace sup
@@ -26,20 +26,30 @@
 #include "named_callback_manager.h"
 #include "variable.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace sup
 {
 namespace dto
 {
+class AnyType;
 class AnyValue;
 class AnyTypeRegistry;
 }  // namespace dto
 
 namespace oac_tree
 {
+class DeadlineTimer;
+class ParsedTypeCache;
+class WorkerPool;
+
 /**
  * @brief Container class for managing variables.
  */
@@ -48,6 +58,7 @@ class Workspace
 public:
   using GenericCallback = std::function<void(const std::string&, const sup::dto::AnyValue&, bool)>;
   using VariableCallback = std::function<void(const sup::dto::AnyValue&, bool)>;
+  using BatchCallback = std::function<void(const std::vector<std::string>&)>;
 
   Workspace(const std::string& filename = "");
   ~Workspace();
@@ -83,6 +94,16 @@ public:
    */
   void Teardown();
 
+  /**
+   * @brief Reset all variables to their state just after Setup.
+   *
+   * @details If the workspace was not setup yet, this is equivalent to calling Setup. Otherwise,
+   * variables that support it are reset in place, which allows them to restore their initial value
+   * without parsing their attributes again. The other variables are torn down and set up again,
+   * together with the global setup and teardown actions they registered.
+   */
+  void Reset();
+
   /**
    * @brief Reset specific variable.
    *
@@ -101,6 +122,17 @@ public:
    */
   bool GetValue(const std::string& name, sup::dto::AnyValue& value) const;
 
+  /**
+   * @brief Get a read-only snapshot of a variable value.
+   *
+   * @param name Variable name/field.
+   *
+   * @return Shared pointer to the value or nullptr on failure.
+   * @note See Variable::GetSnapshot. Fields and values that are private to the calling thread (see
+   * BindLocalValue and BeginTransaction) are always copied.
+   */
+  std::shared_ptr<const sup::dto::AnyValue> GetSnapshot(const std::string& name) const;
+
   /**
    * @brief Set variable value
    *
@@ -111,6 +143,103 @@ public:
    */
   bool SetValue(const std::string& name, const sup::dto::AnyValue& value);
 
+  /**
+   * @brief Atomically update variable value.
+   *
+   * @param name Variable name/field.
+   * @param func Function that modifies the value passed to it and returns true on success.
+   *
+   * @return True on success.
+   *
+   * @note See Variable::UpdateValue.
+   */
+  bool UpdateValue(const std::string& name, const Variable::UpdateFunction& func);
+
+  /**
+   * @brief Atomically update variable value in place, without copying it.
+   *
+   * @param name Variable name/field.
+   * @param func Function that modifies the value passed to it and returns true on success. It may
+   * only modify the value when it returns true.
+   *
+   * @return True on success.
+   *
+   * @note See Variable::UpdateValueInPlace. Thread-private bindings and transactions hold their
+   * own copy of the value and are updated as in UpdateValue.
+   */
+  bool UpdateValueInPlace(const std::string& name, const Variable::UpdateFunction& func);
+
+  /**
+   * @brief Atomically replace variable value if it equals the expected value.
+   *
+   * @param name Variable name/field.
+   * @param expected Value to compare the current value to.
+   * @param desired Value to write when the comparison succeeds.
+   *
+   * @return True if the value was replaced.
+   */
+  bool CompareAndSwap(const std::string& name, const sup::dto::AnyValue& expected,
+                      const sup::dto::AnyValue& desired);
+
+  /**
+   * @brief Start a transaction for the calling thread.
+   *
+   * @details Until the transaction is committed or aborted, writes from the calling thread through
+   * SetValue, UpdateValue and CompareAndSwap are staged instead of being applied to the variables.
+   * Reads from the calling thread see the staged values, while other threads keep seeing the
+   * current values of the variables. Staged values keep the type of the variable's value, so
+   * writes that cannot be converted to it fail immediately.
+   *
+   * @return false if the calling thread already has an active transaction.
+   */
+  bool BeginTransaction();
+
+  /**
+   * @brief Atomically apply all writes staged in the transaction of the calling thread.
+   *
+   * @details The modified variables are locked in name order and verified to still hold the value
+   * they had when first staged. Then all values are written and only after releasing the locks, a
+   * single notification is sent per modified variable, followed by one batch notification with the
+   * names of all modified variables (see RegisterBatchCallback). If a variable was concurrently
+   * modified or a write fails, the variables that were already written are restored and no
+   * notifications are sent.
+   *
+   * @return true on success, false on failure or if the calling thread had no active transaction.
+   * @note The transaction of the calling thread is always ended, even on failure.
+   */
+  bool CommitTransaction();
+
+  /**
+   * @brief Discard all writes staged in the transaction of the calling thread and end it.
+   */
+  void AbortTransaction();
+
+  /**
+   * @brief Query if the calling thread has an active transaction.
+   */
+  bool HasTransaction() const;
+
+  /**
+   * @brief Bind a private value to a variable for the calling thread.
+   *
+   * @details Until unbound, reads and writes from the calling thread to this variable (or its
+   * fields) use the private value, while other threads keep seeing the variable itself. Writes to
+   * a bound variable are not staged in transactions and do not trigger notifications. When a field
+   * is given, the variable is first bound to a copy of its current value.
+   *
+   * @param name Variable name/field.
+   * @param value Private value.
+   *
+   * @return true on success.
+   * @note Bindings are not inherited by threads that are launched from the calling thread.
+   */
+  bool BindLocalValue(const std::string& name, const sup::dto::AnyValue& value);
+
+  /**
+   * @brief Remove all private variable bindings of the calling thread.
+   */
+  void UnbindLocalValues();
+
   /**
    * @brief Wait with timeout for variable to become available.
    *
@@ -123,6 +252,51 @@ public:
    */
   bool WaitForVariable(const std::string& name, double timeout_sec, bool availability = true);
 
+  /**
+   * @brief Request the procedure to be ticked again as soon as possible.
+   *
+   * @details Instructions that wait for external events (e.g. variable updates) use this to cut
+   * short the timeout between ticks (see WaitForTickRequest).
+   */
+  void RequestTick() const;
+
+  /**
+   * @brief Wait until a tick is requested or the timeout expires.
+   *
+   * @param timeout_ns Timeout in nanoseconds.
+   *
+   * @return true if a tick was requested. The request is consumed.
+   */
+  bool WaitForTickRequest(sup::dto::int64 timeout_ns) const;
+
+  /**
+   * @brief Schedule a callback to be called once when a steady clock deadline passes.
+   *
+   * @details All callbacks of a workspace are called from a single timer thread, so instructions
+   * can react to deadlines without polling or spawning their own threads. Callbacks should return
+   * quickly, e.g. by halting an instruction and requesting a tick.
+   *
+   * @param deadline Deadline on the steady clock.
+   * @param callback Callback function.
+   *
+   * @return Guard that cancels the callback when destroyed (and waits for it to return when it is
+   * running at that moment).
+   */
+  ScopeGuard ScheduleDeadline(std::chrono::steady_clock::time_point deadline,
+                              std::function<void()> callback) const;
+
+  /**
+   * @brief Run a task on a worker thread of the workspace.
+   *
+   * @details The worker threads are shared by all instructions and reused across executions, so
+   * instructions that need to run work concurrently do not have to manage their own threads. A
+   * submitted task always starts without waiting for other tasks to finish.
+   *
+   * @param task Task to run.
+   * @note Instructions are responsible for waiting until their tasks have finished.
+   */
+  void SubmitWork(std::function<void()> task) const;
+
   std::vector<const Variable*> GetVariables() const;
 
   /**
@@ -157,6 +331,31 @@ public:
    */
   const sup::dto::AnyTypeRegistry& GetTypeRegistry() const;
 
+  /**
+   * @brief Parse a type from its JSON representation, using the type registry of this workspace.
+   *
+   * @param json_type JSON representation of the type.
+   * @param anytype Output parameter for the parsed type.
+   *
+   * @return true on successful parsing.
+   * @note Successfully parsed types are cached, so parsing the same string again is cheap.
+   */
+  bool ParseType(const std::string& json_type, sup::dto::AnyType& anytype) const;
+
+  /**
+   * @brief Parse a value from its JSON type and value representations, using the type registry of
+   * this workspace.
+   *
+   * @param json_type JSON representation of the type.
+   * @param json_value JSON representation of the value.
+   * @param anyvalue Output parameter for the parsed value.
+   *
+   * @return true on successful parsing.
+   * @note Successfully parsed values are cached, so parsing the same pair of strings again is cheap.
+   */
+  bool ParseValue(const std::string& json_type, const std::string& json_value,
+                  sup::dto::AnyValue& anyvalue) const;
+
   /**
    * @brief Get a callback guard object.
    *
@@ -193,6 +392,19 @@ public:
    */
   bool RegisterCallback(const std::string& name, const VariableCallback& cb, void* listener);
 
+  /**
+   * @brief Add callback for variables that were updated together by a committed transaction.
+   *
+   * @param cb Callback function object, called with the names of the updated variables.
+   * @param listener Pointer to object that listens to these updates (used for unregistering).
+   * @return true if adding the callback was successful.
+   *
+   * @note Batch callbacks are called once per committed transaction, after the notifications of
+   * the individual variables. Observers that need a consistent view of several variables can
+   * wait for this callback instead of reacting to each variable update.
+   */
+  bool RegisterBatchCallback(const BatchCallback& cb, void* listener = nullptr);
+
   /**
    * @brief Query if the workspace was already successfully setup.
    *
@@ -202,6 +414,17 @@ public:
   bool IsSuccessfullySetup() const;
 
 private:
+  /**
+   * @brief Value of a variable that was written during a transaction.
+   */
+  struct StagedValue
+  {
+    sup::dto::AnyValue m_original;
+    sup::dto::AnyValue m_value;
+  };
+  using Transaction = std::map<std::string, StagedValue>;
+  using LocalBindings = std::map<std::string, sup::dto::AnyValue>;
+
   /**
    * @brief Filename of the Procedure it's part of.
    */
@@ -226,13 +449,63 @@ private:
 
   std::unique_ptr<sup::dto::AnyTypeRegistry> m_type_registry;
 
+  /**
+   * @brief Cache of types and values parsed with the type registry.
+   */
+  std::unique_ptr<ParsedTypeCache> m_type_cache;
+
   std::vector<std::function<void()>> m_teardown_actions;
 
+  /**
+   * @brief Global setup and teardown actions, per variable that registered them.
+   */
+  std::map<std::string, SetupTeardownActions> m_variable_actions;
+
   /**
    * @brief Flag that indicates setup was already called on this workspace.
    */
   bool m_setup_done;
 
+  /**
+   * @brief Active transactions, per thread.
+   *
+   * @note The map is protected by the transactions mutex, while each transaction is only accessed
+   * by its own thread.
+   */
+  mutable std::map<std::thread::id, Transaction> m_transactions;
+  mutable std::mutex m_transactions_mutex;
+
+  /**
+   * @brief Number of active transactions, used to skip the transaction lookup in the common case.
+   */
+  std::atomic<std::size_t> m_n_transactions;
+
+  /**
+   * @brief Private variable values, per thread.
+   *
+   * @note Same access rules as for the transactions.
+   */
+  mutable std::map<std::thread::id, LocalBindings> m_local_bindings;
+  mutable std::mutex m_local_bindings_mutex;
+  std::atomic<std::size_t> m_n_local_bindings;
+
+  /**
+   * @brief Pending tick request and its synchronization.
+   */
+  mutable bool m_tick_requested;
+  mutable std::mutex m_tick_mutex;
+  mutable std::condition_variable m_tick_cv;
+
+  /**
+   * @brief Timer for callbacks scheduled by instructions.
+   */
+  std::unique_ptr<DeadlineTimer> m_timer;
+
+  /**
+   * @brief Worker threads for tasks submitted by instructions.
+   */
+  std::unique_ptr<WorkerPool> m_worker_pool;
+
   /**
    * @brief Check if the given Variable name is already present.
    *
@@ -250,6 +523,45 @@ private:
   std::vector<std::function<void()>> ParseSetupTeardownActions(
     const std::vector<SetupTeardownActions>& actions);
 
+  /**
+   * @brief Get the global setup and teardown actions of all variables, ordered by variable name.
+   */
+  std::vector<SetupTeardownActions> GetVariableActions() const;
+
+  /**
+   * @brief Get the active transaction of the calling thread.
+   *
+   * @return Pointer to the transaction or nullptr if there is none.
+   */
+  Transaction* GetTransaction() const;
+
+  /**
+   * @brief Get the private value of a variable for the calling thread.
+   *
+   * @param varname Variable name.
+   * @return Pointer to the private value or nullptr if the variable is not bound.
+   */
+  sup::dto::AnyValue* GetLocalBinding(const std::string& varname) const;
+
+  /**
+   * @brief Get the staged value of a variable, staging its current value if needed.
+   *
+   * @param transaction Transaction of the calling thread.
+   * @param varname Variable name.
+   * @param var Variable with the given name.
+   * @return Reference to the staged value.
+   */
+  sup::dto::AnyValue& StageVariable(Transaction& transaction, const std::string& varname,
+                                    const Variable& var) const;
+
+  /**
+   * @brief Write the staged values of a transaction to the variables.
+   *
+   * @param transaction Transaction to commit.
+   * @return true on success.
+   */
+  bool ApplyTransaction(const Transaction& transaction);
+
   /**
    * @brief Method which is called if a variable is updated.
    *
@@ -29,6 +29,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
 #include <thread>
 
 using namespace sup::oac_tree;
@@ -94,6 +97,77 @@ inline AsyncInputAdapter::InterruptFunction GetInterruptFunction(TestUserInput&
   return std::bind(&TestUserInput::Interrupt, std::addressof(test_input), _1);
 }
 
+/**
+ * @brief ConcurrentUserInput handles multiple user input requests at the same time. Each request
+ * blocks until it is explicitly released (or interrupted) and its reply contains the request id.
+ *
+ */
+class ConcurrentUserInput
+{
+public:
+  ConcurrentUserInput() = default;
+  ~ConcurrentUserInput() = default;
+
+  UserInputReply GetUserValue(const UserInputRequest& request, sup::dto::uint64 id) {
+    (void)request;
+    std::unique_lock<std::mutex> lk{m_mtx};
+    m_active.insert(id);
+    m_cv.notify_all();
+    auto pred = [this, id]() {
+      return m_released.count(id) > 0 || m_interrupted.count(id) > 0;
+    };
+    m_cv.wait_for(lk, std::chrono::seconds(5), pred);
+    m_active.erase(id);
+    if (m_released.count(id) == 0)
+    {
+      return { InputRequestType::kUserValue, false, {} };
+    }
+    return CreateUserValueReply(true, sup::dto::AnyValue{sup::dto::UnsignedInteger64Type, id});
+  }
+
+  void Interrupt(sup::dto::uint64 id) {
+    {
+      std::lock_guard<std::mutex> lk{m_mtx};
+      m_interrupted.insert(id);
+    }
+    m_cv.notify_all();
+  }
+
+  void Release(sup::dto::uint64 id) {
+    {
+      std::lock_guard<std::mutex> lk{m_mtx};
+      m_released.insert(id);
+    }
+    m_cv.notify_all();
+  }
+
+  bool WaitForActive(std::size_t n_active, double seconds) {
+    std::unique_lock<std::mutex> lk{m_mtx};
+    return m_cv.wait_for(lk, std::chrono::duration<double>(seconds),
+                         [this, n_active]() { return m_active.size() == n_active; });
+  }
+
+  bool IsInterrupted(sup::dto::uint64 id) {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    return m_interrupted.count(id) > 0;
+  }
+
+  AsyncInputAdapter::InputFunction GetInputFunction() {
+    return std::bind(&ConcurrentUserInput::GetUserValue, this, _1, _2);
+  }
+
+  AsyncInputAdapter::InterruptFunction GetInterruptFunction() {
+    return std::bind(&ConcurrentUserInput::Interrupt, this, _1);
+  }
+
+private:
+  std::set<sup::dto::uint64> m_active;
+  std::set<sup::dto::uint64> m_released;
+  std::set<sup::dto::uint64> m_interrupted;
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+};
+
 class AsyncInputAdapterTest : public ::testing::Test
 {
 protected:
@@ -183,6 +257,72 @@ TEST_F(AsyncInputAdapterTest, MultipleRequests)
   EXPECT_FALSE(future_1->WaitFor(0.0));
 }
 
+TEST_F(AsyncInputAdapterTest, SerializedByDefault)
+{
+  // Verify that by default, a second request is only handled after the first one was answered.
+  ConcurrentUserInput user_input;
+  AsyncInputAdapter async_input{ user_input.GetInputFunction(),
+                                 user_input.GetInterruptFunction() };
+  auto future_1 = async_input.AddUserInputRequest(m_request);
+  auto future_2 = async_input.AddUserInputRequest(m_request);
+  EXPECT_TRUE(user_input.WaitForActive(1, 1.0));
+  EXPECT_FALSE(user_input.WaitForActive(2, 0.1));
+  user_input.Release(future_1->GetId());
+  EXPECT_TRUE(future_1->WaitFor(1.0));
+  EXPECT_TRUE(user_input.WaitForActive(1, 1.0));
+  EXPECT_FALSE(future_2->IsReady());
+  user_input.Release(future_2->GetId());
+  EXPECT_TRUE(future_2->WaitFor(1.0));
+}
+
+TEST_F(AsyncInputAdapterTest, ConcurrentRequests)
+{
+  // Verify that concurrent requests are outstanding at the same time and can be answered in any
+  // order.
+  ConcurrentUserInput user_input;
+  AsyncInputAdapter async_input{ user_input.GetInputFunction(),
+                                 user_input.GetInterruptFunction(), 2 };
+  auto future_1 = async_input.AddUserInputRequest(m_request);
+  auto future_2 = async_input.AddUserInputRequest(m_request);
+  auto future_3 = async_input.AddUserInputRequest(m_request);
+  EXPECT_TRUE(user_input.WaitForActive(2, 1.0));
+  // Third request waits for a free handler:
+  EXPECT_FALSE(user_input.WaitForActive(3, 0.1));
+  user_input.Release(future_2->GetId());
+  EXPECT_TRUE(future_2->WaitFor(1.0));
+  EXPECT_FALSE(future_1->IsReady());
+  const sup::dto::AnyValue expected_2{sup::dto::UnsignedInteger64Type, future_2->GetId()};
+  EXPECT_EQ(future_2->GetValue(), CreateUserValueReply(true, expected_2));
+  // Third request is now being handled together with the first:
+  EXPECT_TRUE(user_input.WaitForActive(2, 1.0));
+  user_input.Release(future_3->GetId());
+  user_input.Release(future_1->GetId());
+  EXPECT_TRUE(future_3->WaitFor(1.0));
+  EXPECT_TRUE(future_1->WaitFor(1.0));
+  const sup::dto::AnyValue expected_1{sup::dto::UnsignedInteger64Type, future_1->GetId()};
+  EXPECT_EQ(future_1->GetValue(), CreateUserValueReply(true, expected_1));
+}
+
+TEST_F(AsyncInputAdapterTest, CancelConcurrentRequest)
+{
+  // Verify that cancelling one of the active requests only interrupts that request.
+  ConcurrentUserInput user_input;
+  AsyncInputAdapter async_input{ user_input.GetInputFunction(),
+                                 user_input.GetInterruptFunction(), 2 };
+  auto future_1 = async_input.AddUserInputRequest(m_request);
+  sup::dto::uint64 id_2{0};
+  {
+    auto future_2 = async_input.AddUserInputRequest(m_request);
+    id_2 = future_2->GetId();
+    EXPECT_TRUE(user_input.WaitForActive(2, 1.0));
+  }
+  EXPECT_TRUE(user_input.IsInterrupted(id_2));
+  EXPECT_FALSE(user_input.IsInterrupted(future_1->GetId()));
+  EXPECT_TRUE(user_input.WaitForActive(1, 1.0));
+  user_input.Release(future_1->GetId());
+  EXPECT_TRUE(future_1->WaitFor(1.0));
+}
+
 AsyncInputAdapterTest::AsyncInputAdapterTest()
   : m_value{sup::dto::UnsignedInteger8Type, 42u}
   , m_request{CreateUserValueRequest(m_value, "Give me a number")}
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+TEST(AtomicSequence, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("AtomicSequence");
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  EXPECT_TRUE(AppendChildInstruction(*instr, GlobalInstructionRegistry().Create("Succeed")));
+  EXPECT_NO_THROW(instr->Setup(proc));
+}
+
+TEST(AtomicSequence, BlockingChildren)
+{
+  // Children that wait or run on other threads would stall the runner
+  Procedure proc;
+  for (const std::string type : { "Wait", "Async", "ParallelSequence" })
+  {
+    auto instr = GlobalInstructionRegistry().Create("AtomicSequence");
+    EXPECT_TRUE(AppendChildInstruction(*instr, GlobalInstructionRegistry().Create("Succeed")));
+    auto child = GlobalInstructionRegistry().Create(type);
+    if (type != "Wait")
+    {
+      EXPECT_TRUE(AppendChildInstruction(*child, GlobalInstructionRegistry().Create("Succeed")));
+    }
+    auto sequence = GlobalInstructionRegistry().Create("Sequence");
+    EXPECT_TRUE(AppendChildInstruction(*sequence, std::move(child)));
+    EXPECT_TRUE(AppendChildInstruction(*instr, std::move(sequence)));
+    EXPECT_THROW(instr->Setup(proc), InstructionSetupException) << "Type: " << type;
+  }
+}
+
+TEST(AtomicSequence, ChildrenWaitingForEvents)
+{
+  // Non-blocking children that stay RUNNING until something happens would keep the transaction
+  // open indefinitely
+  const std::vector<std::string> children{
+    R"(<UserChoice description="choose"><Succeed/></UserChoice>)",
+    R"(<Periodic period="0.01" maxCount="2" blocking="false"><Succeed/></Periodic>)",
+    R"(<Repeat maxCount="2"><Succeed/></Repeat>)"
+  };
+  for (const auto& child : children)
+  {
+    const std::string body = "<AtomicSequence>" + child + "</AtomicSequence><Workspace/>";
+    auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+    ASSERT_TRUE(proc.get() != nullptr);
+    EXPECT_THROW(proc->Setup(), InstructionSetupException) << "Child: " << child;
+  }
+}
+
+TEST(AtomicSequence, Success)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <AtomicSequence>
+            <Increment varName="a"/>
+            <Equals leftVar="a" rightVar="one"/>
+            <Copy inputVar="a" outputVar="b"/>
+            <Increment varName="b"/>
+            <Inverter><Fail/></Inverter>
+        </AtomicSequence>
+        <Equals leftVar="a" rightVar="one"/>
+        <Equals leftVar="b" rightVar="two"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint8"}' value='0' />
+        <Local name="b" type='{"type":"uint8"}' value='0' />
+        <Local name="one" type='{"type":"uint8"}' value='1' />
+        <Local name="two" type='{"type":"uint8"}' value='2' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(AtomicSequence, FailureDiscardsWrites)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <Inverter>
+            <AtomicSequence>
+                <Increment varName="a"/>
+                <Copy inputVar="a" outputVar="b"/>
+                <Fail/>
+            </AtomicSequence>
+        </Inverter>
+        <Equals leftVar="a" rightVar="zero"/>
+        <Equals leftVar="b" rightVar="zero"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint8"}' value='0' />
+        <Local name="b" type='{"type":"uint8"}' value='0' />
+        <Local name="zero" type='{"type":"uint8"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(AtomicSequence, Nested)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <Inverter>
+            <AtomicSequence>
+                <AtomicSequence>
+                    <Increment varName="a"/>
+                </AtomicSequence>
+                <Equals leftVar="a" rightVar="one"/>
+                <Fail/>
+            </AtomicSequence>
+        </Inverter>
+        <Equals leftVar="a" rightVar="zero"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint8"}' value='0' />
+        <Local name="zero" type='{"type":"uint8"}' value='0' />
+        <Local name="one" type='{"type":"uint8"}' value='1' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
@@ -0,0 +1,152 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/cancellation_token.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace sup::oac_tree;
+
+class CancellationTokenTest : public ::testing::Test
+{
+protected:
+  CancellationTokenTest() = default;
+  virtual ~CancellationTokenTest() = default;
+};
+
+TEST_F(CancellationTokenTest, CancelAndClear)
+{
+  CancellationToken parent;
+  CancellationToken child;
+  child.SetParent(parent);
+  EXPECT_FALSE(parent.IsCancelled());
+  EXPECT_FALSE(child.IsCancelled());
+
+  // Cancellation propagates down, not up
+  child.Cancel();
+  EXPECT_FALSE(parent.IsCancelled());
+  EXPECT_TRUE(child.IsCancelled());
+  child.Clear();
+  parent.Cancel();
+  EXPECT_TRUE(parent.IsCancelled());
+  EXPECT_TRUE(child.IsCancelled());
+
+  // Clearing a child does not hide the cancellation of its parent
+  child.Clear();
+  EXPECT_TRUE(child.IsCancelled());
+  parent.Clear();
+  EXPECT_FALSE(child.IsCancelled());
+
+  // Copies share their state
+  CancellationToken copy{child};
+  child.Cancel();
+  EXPECT_TRUE(copy.IsCancelled());
+}
+
+TEST_F(CancellationTokenTest, WakeCallbacks)
+{
+  CancellationToken parent;
+  CancellationToken child;
+  child.SetParent(parent);
+  int n_wakes = 0;
+  {
+    auto guard = child.RegisterWakeCallback([&n_wakes]() { ++n_wakes; });
+    parent.Cancel();
+    EXPECT_EQ(n_wakes, 1);
+    child.Cancel();
+    EXPECT_EQ(n_wakes, 2);
+  }
+  parent.Cancel();
+  child.Cancel();
+  EXPECT_EQ(n_wakes, 2);
+}
+
+TEST_F(CancellationTokenTest, WaitUntil)
+{
+  CancellationToken parent;
+  CancellationToken child;
+  child.SetParent(parent);
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+  EXPECT_FALSE(child.WaitUntil(deadline));
+  EXPECT_GE(std::chrono::steady_clock::now(), deadline);
+
+  auto start = std::chrono::steady_clock::now();
+  auto canceller = std::async(std::launch::async, [&parent]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    parent.Cancel();
+  });
+  EXPECT_TRUE(child.WaitUntil(start + std::chrono::seconds(60)));
+  canceller.get();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(CancellationTokenTest, WaitUntilPrecise)
+{
+  CancellationToken token;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+  EXPECT_FALSE(token.WaitUntilPrecise(deadline));
+  EXPECT_GE(std::chrono::steady_clock::now(), deadline);
+
+  auto start = std::chrono::steady_clock::now();
+  auto canceller = std::async(std::launch::async, [&token]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    token.Cancel();
+  });
+  EXPECT_TRUE(token.WaitUntilPrecise(start + std::chrono::seconds(60)));
+  canceller.get();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(CancellationTokenTest, InstructionTree)
+{
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  Procedure proc;
+  auto sequence = GlobalInstructionRegistry().Create("Sequence");
+  auto inverter = GlobalInstructionRegistry().Create("Inverter");
+  auto wait = GlobalInstructionRegistry().Create("Wait");
+  auto wait_ptr = wait.get();
+  ASSERT_TRUE(AppendChildInstruction(*inverter, std::move(wait)));
+  auto inverter_ptr = inverter.get();
+  ASSERT_TRUE(AppendChildInstruction(*sequence, std::move(inverter)));
+  EXPECT_NO_THROW(sequence->Setup(proc));
+
+  // Halting a subtree is visible in its descendants only
+  EXPECT_FALSE(wait_ptr->GetCancellationToken().IsCancelled());
+  inverter_ptr->Halt();
+  EXPECT_TRUE(wait_ptr->GetCancellationToken().IsCancelled());
+  EXPECT_FALSE(sequence->GetCancellationToken().IsCancelled());
+  sequence->Reset(ui);
+  EXPECT_FALSE(wait_ptr->GetCancellationToken().IsCancelled());
+
+  sequence->Halt();
+  EXPECT_TRUE(wait_ptr->GetCancellationToken().IsCancelled());
+  sequence->Reset(ui);
+  EXPECT_FALSE(wait_ptr->GetCancellationToken().IsCancelled());
+}
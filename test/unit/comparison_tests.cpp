@@ -22,6 +22,8 @@
 
 #include "unit_test_helper.h"
 
+#include <sup/oac-tree/instructions/array_comparison.h>
+
 #include <sup/oac-tree/exceptions.h>
 #include <sup/oac-tree/execution_status.h>
 #include <sup/oac-tree/instruction_registry.h>
@@ -195,7 +197,132 @@ TEST(LessThan, Failure)
   EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
 }
 
+TEST(ArrayComparison, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("LessThan");
+  EXPECT_TRUE(instr->AddAttribute("leftVar", "left_var"));
+  EXPECT_TRUE(instr->AddAttribute("rightVar", "right_var"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+
+  // Output variable without array mode
+  EXPECT_TRUE(instr->AddAttribute("outputVar", "out"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  // Unknown array mode
+  EXPECT_TRUE(instr->AddAttribute("arrayMode", "some"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  // Output variable is only supported in count and elementwise modes
+  EXPECT_TRUE(instr->SetAttribute("arrayMode", "all"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->SetAttribute("arrayMode", "count"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+  EXPECT_TRUE(instr->SetAttribute("arrayMode", "elementwise"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+
+  auto any_instr = GlobalInstructionRegistry().Create("Equals");
+  EXPECT_TRUE(any_instr->AddAttribute("leftVar", "left_var"));
+  EXPECT_TRUE(any_instr->AddAttribute("rightVar", "right_var"));
+  EXPECT_TRUE(any_instr->AddAttribute("arrayMode", "any"));
+  EXPECT_NO_THROW(any_instr->Setup(proc));
+  EXPECT_TRUE(any_instr->SetAttribute("arrayMode", "count"));
+  EXPECT_THROW(any_instr->Setup(proc), InstructionSetupException);
+}
+
+TEST(ArrayComparison, CompareElementwise)
+{
+  std::vector<sup::dto::uint8> result;
+  std::string error;
+  sup::dto::AnyValue signed_arr = sup::dto::ArrayValue({sup::dto::int32{-2}, sup::dto::int32{0},
+                                                        sup::dto::int32{5}});
+  sup::dto::AnyValue float_arr = sup::dto::ArrayValue({-1.5, 0.0, 4.5});
+  sup::dto::AnyValue unsigned_arr = sup::dto::ArrayValue({sup::dto::uint64{1}, sup::dto::uint64{0},
+                                                          sup::dto::uint64{18446744073709551615u}});
+
+  // Array against scalar
+  EXPECT_TRUE(CompareElementwise(signed_arr, sup::dto::AnyValue{sup::dto::int32{0}},
+                                 ComparisonOperator::kLessThanOrEqual, result, error));
+  EXPECT_EQ(result, std::vector<sup::dto::uint8>({1, 1, 0}));
+
+  // Scalar against array
+  EXPECT_TRUE(CompareElementwise(sup::dto::AnyValue{sup::dto::int32{0}}, signed_arr,
+                                 ComparisonOperator::kGreaterThan, result, error));
+  EXPECT_EQ(result, std::vector<sup::dto::uint8>({1, 0, 0}));
+
+  // Mixed integer and floating point arrays
+  EXPECT_TRUE(CompareElementwise(signed_arr, float_arr, ComparisonOperator::kLessThan, result,
+                                 error));
+  EXPECT_EQ(result, std::vector<sup::dto::uint8>({1, 0, 0}));
+
+  // Large unsigned values
+  EXPECT_TRUE(CompareElementwise(unsigned_arr, sup::dto::AnyValue{sup::dto::uint8{1}},
+                                 ComparisonOperator::kGreaterThanOrEqual, result, error));
+  EXPECT_EQ(result, std::vector<sup::dto::uint8>({1, 0, 1}));
+  EXPECT_TRUE(CompareElementwise(unsigned_arr, signed_arr, ComparisonOperator::kEqual, result,
+                                 error));
+  EXPECT_EQ(result, std::vector<sup::dto::uint8>({0, 1, 0}));
+
+  // Errors
+  sup::dto::AnyValue short_arr = sup::dto::ArrayValue({sup::dto::int32{1}});
+  EXPECT_FALSE(CompareElementwise(signed_arr, short_arr, ComparisonOperator::kEqual, result,
+                                  error));
+  EXPECT_FALSE(error.empty());
+  sup::dto::AnyValue string_arr = sup::dto::ArrayValue({std::string{"a"}});
+  EXPECT_FALSE(CompareElementwise(string_arr, short_arr, ComparisonOperator::kEqual, result,
+                                  error));
+}
 
+TEST(ArrayComparison, Reductions)
+{
+  const std::string body{R"(
+    <Sequence>
+        <LessThan leftVar="samples" rightVar="limit" arrayMode="all"/>
+        <Inverter>
+            <GreaterThan leftVar="samples" rightVar="limit" arrayMode="any"/>
+        </Inverter>
+        <GreaterThanOrEqual leftVar="samples" rightVar="threshold" arrayMode="any"/>
+        <Equals leftVar="samples" rightVar="samples" arrayMode="all"/>
+        <GreaterThanOrEqual leftVar="samples" rightVar="threshold" arrayMode="count"
+                            outputVar="count"/>
+        <Equals leftVar="count" rightVar="expected_count"/>
+        <LessThanOrEqual leftVar="samples" rightVar="threshold" arrayMode="elementwise"
+                         outputVar="flags"/>
+        <Equals leftVar="flags" rightVar="expected_flags" arrayMode="all"/>
+    </Sequence>
+    <Workspace>
+        <Local name="samples" type='{"type":"float64_arr","element":{"type":"float64"}}'
+               value="[0.5, 2.5, 1.5, 3.0]"/>
+        <Local name="limit" type='{"type":"float64"}' value='10.0' />
+        <Local name="threshold" type='{"type":"int32"}' value='2' />
+        <Local name="count" type='{"type":"uint32"}' value='0' />
+        <Local name="expected_count" type='{"type":"uint32"}' value='2' />
+        <Local name="flags" dynamicType="true" />
+        <Local name="expected_flags" type='{"type":"bool_arr","element":{"type":"bool"}}'
+               value="[true, false, true, false]"/>
+    </Workspace>
+)"};
 
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::SUCCESS));
+}
 
+TEST(ArrayComparison, Failure)
+{
+  const std::string body{R"(
+    <LessThan leftVar="samples" rightVar="limits" arrayMode="all"/>
+    <Workspace>
+        <Local name="samples" type='{"type":"uint16_arr","element":{"type":"uint16"}}'
+               value="[1, 2, 3]"/>
+        <Local name="limits" type='{"type":"uint16_arr","element":{"type":"uint16"}}'
+               value="[5, 5]"/>
+    </Workspace>
+)"};
 
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
@@ -63,6 +63,13 @@ TEST_F(CompoundInstructionTest, InsertChild)
   EXPECT_EQ(compound.ChildrenCount(), 3);
 
   EXPECT_EQ(compound.ChildInstructions(), std::vector<Instruction*>({child0, child2, child1}));
+  auto children = compound.Children();
+  EXPECT_EQ(std::vector<Instruction*>(children.begin(), children.end()),
+            std::vector<Instruction*>({child0, child2, child1}));
+  const auto& const_compound = compound;
+  ConstChildRange const_children = const_compound.Children();
+  ASSERT_EQ(const_children.size(), 3);
+  EXPECT_EQ(const_children[1], child2);
 
   // wrong insert index
   EXPECT_FALSE(compound.InsertInstruction(nullptr, -1));
@@ -0,0 +1,190 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+using namespace sup::oac_tree;
+
+TEST(CopyMany, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("CopyMany");
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  EXPECT_TRUE(instr->AddAttribute("inputVars", "a, b"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->AddAttribute("outputVars", "x"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->SetAttribute("outputVars", "x,y"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+
+  EXPECT_TRUE(instr->SetAttribute("inputVars", ","));
+  EXPECT_TRUE(instr->SetAttribute("outputVars", ""));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+}
+
+TEST(CopyMany, Success)
+{
+  const std::string body{R"(
+    <Sequence>
+        <CopyMany inputVars="a,b,c,s" outputVars="s.x,s.y,out_c,out_dyn"/>
+        <Equals leftVar="s.x" rightVar="a"/>
+        <Equals leftVar="s.y" rightVar="b"/>
+        <Equals leftVar="out_c" rightVar="c"/>
+        <Equals leftVar="out_dyn.y" rightVar="b"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='1' />
+        <Local name="b" type='{"type":"uint32"}' value='2' />
+        <Local name="c" type='{"type":"string"}' value='"text"' />
+        <Local name="s"
+               type='{"type":"pair_t","attributes":[{"x":{"type":"uint32"}},{"y":{"type":"uint32"}}]}'
+               value='{"x":0,"y":0}' />
+        <Local name="out_c" type='{"type":"string"}' value='""' />
+        <Local name="out_dyn" />
+    </Workspace>
+)"};
+
+  std::map<std::string, int> notifications;
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_NO_THROW(proc->Setup());
+  EXPECT_TRUE(proc->GetWorkspace().RegisterGenericCallback(
+    [&notifications](const std::string& name, const sup::dto::AnyValue&, bool)
+    {
+      ++notifications[name];
+    }, &notifications));
+  EXPECT_TRUE(sup::UnitTestHelper::ExecuteAfterSetup(proc, ui, ExecutionStatus::SUCCESS));
+  // Without transaction, every copy notifies separately
+  EXPECT_EQ(notifications["s"], 2);
+  EXPECT_EQ(notifications["out_c"], 1);
+  EXPECT_EQ(notifications["out_dyn"], 1);
+}
+
+TEST(CopyMany, Transactional)
+{
+  const std::string body{R"(
+    <Sequence>
+        <CopyMany inputVars="a,b,c" outputVars="s.x,s.y,out_c" transactional="true"/>
+        <Equals leftVar="s.x" rightVar="a"/>
+        <Equals leftVar="s.y" rightVar="b"/>
+        <Equals leftVar="out_c" rightVar="c"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='1' />
+        <Local name="b" type='{"type":"uint32"}' value='2' />
+        <Local name="c" type='{"type":"string"}' value='"text"' />
+        <Local name="s"
+               type='{"type":"pair_t","attributes":[{"x":{"type":"uint32"}},{"y":{"type":"uint32"}}]}'
+               value='{"x":0,"y":0}' />
+        <Local name="out_c" type='{"type":"string"}' value='""' />
+    </Workspace>
+)"};
+
+  std::map<std::string, int> notifications;
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_NO_THROW(proc->Setup());
+  EXPECT_TRUE(proc->GetWorkspace().RegisterGenericCallback(
+    [&notifications](const std::string& name, const sup::dto::AnyValue&, bool)
+    {
+      ++notifications[name];
+    }, &notifications));
+  EXPECT_TRUE(sup::UnitTestHelper::ExecuteAfterSetup(proc, ui, ExecutionStatus::SUCCESS));
+  EXPECT_EQ(notifications["s"], 1);
+  EXPECT_EQ(notifications["out_c"], 1);
+}
+
+TEST(CopyMany, Failure)
+{
+  // Copies before the failing one are applied
+  const std::string body{R"(
+    <Sequence>
+        <CopyMany inputVars="a,does_not_exist,c" outputVars="s.x,s.y,out_c"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='1' />
+        <Local name="c" type='{"type":"string"}' value='"text"' />
+        <Local name="s"
+               type='{"type":"pair_t","attributes":[{"x":{"type":"uint32"}},{"y":{"type":"uint32"}}]}'
+               value='{"x":0,"y":0}' />
+        <Local name="out_c" type='{"type":"string"}' value='""' />
+    </Workspace>
+)"};
+
+  std::map<std::string, int> notifications;
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_NO_THROW(proc->Setup());
+  EXPECT_TRUE(proc->GetWorkspace().RegisterGenericCallback(
+    [&notifications](const std::string& name, const sup::dto::AnyValue&, bool)
+    {
+      ++notifications[name];
+    }, &notifications));
+  EXPECT_TRUE(sup::UnitTestHelper::ExecuteAfterSetup(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_EQ(notifications["s"], 1);
+  EXPECT_EQ(notifications["out_c"], 0);
+}
+
+TEST(CopyMany, TransactionalFailure)
+{
+  // No copies are applied, since a string can't be copied to a uint32
+  const std::string body{R"(
+    <Sequence>
+        <CopyMany inputVars="a,b,c" outputVars="s.x,s.y,a" transactional="true"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='1' />
+        <Local name="b" type='{"type":"uint32"}' value='2' />
+        <Local name="c" type='{"type":"string"}' value='"text"' />
+        <Local name="s"
+               type='{"type":"pair_t","attributes":[{"x":{"type":"uint32"}},{"y":{"type":"uint32"}}]}'
+               value='{"x":0,"y":0}' />
+    </Workspace>
+)"};
+
+  std::map<std::string, int> notifications;
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_NO_THROW(proc->Setup());
+  EXPECT_TRUE(proc->GetWorkspace().RegisterGenericCallback(
+    [&notifications](const std::string& name, const sup::dto::AnyValue&, bool)
+    {
+      ++notifications[name];
+    }, &notifications));
+  EXPECT_TRUE(sup::UnitTestHelper::ExecuteAfterSetup(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_EQ(notifications["s"], 0);
+  EXPECT_EQ(notifications["a"], 0);
+}
@@ -90,10 +90,14 @@ TEST_F(DecoratorInstructionTest, ChildInstructions)
   auto instruction = GlobalInstructionRegistry().Create("ForceSuccess");
   ASSERT_TRUE(instruction.get() != nullptr);
   EXPECT_TRUE(instruction->ChildInstructions().empty());
+  EXPECT_TRUE(instruction->Children().empty());
 
   auto child = GlobalInstructionRegistry().Create("Wait");
+  auto child_ptr = child.get();
   EXPECT_TRUE(AppendChildInstruction(*instruction, std::move(child)));
   EXPECT_FALSE(instruction->ChildInstructions().empty());
+  ASSERT_EQ(instruction->Children().size(), 1);
+  EXPECT_EQ(instruction->Children()[0], child_ptr);
 }
 
 TEST_F(DecoratorInstructionTest, ForceSuccess_success)
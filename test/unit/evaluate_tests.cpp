@@ -0,0 +1,254 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/instructions/compiled_expression.h>
+#include <sup/oac-tree/variables/local_variable.h>
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+
+using namespace sup::oac_tree;
+
+static std::unique_ptr<Variable> CreateLocalVariable(const std::string& type,
+                                                     const std::string& value);
+
+class EvaluateTest : public ::testing::Test
+{
+protected:
+  EvaluateTest();
+  virtual ~EvaluateTest();
+
+  ExpressionValue Eval(const std::string& expression);
+
+  Workspace m_ws;
+};
+
+TEST_F(EvaluateTest, Literals)
+{
+  auto result = Eval("42");
+  EXPECT_EQ(result.kind, ExpressionValue::Kind::kInteger);
+  EXPECT_EQ(result.integer, 42);
+
+  result = Eval("2.5e1");
+  EXPECT_EQ(result.kind, ExpressionValue::Kind::kFloat);
+  EXPECT_DOUBLE_EQ(result.floating, 25.0);
+
+  result = Eval("true");
+  EXPECT_EQ(result.kind, ExpressionValue::Kind::kBoolean);
+  EXPECT_TRUE(IsTrue(result));
+  EXPECT_FALSE(IsTrue(Eval("false")));
+}
+
+TEST_F(EvaluateTest, Precedence)
+{
+  EXPECT_EQ(Eval("1 + 2 * 3").integer, 7);
+  EXPECT_EQ(Eval("(1 + 2) * 3").integer, 9);
+  EXPECT_EQ(Eval("10 - 4 - 3").integer, 3);
+  EXPECT_EQ(Eval("-7 / 2").integer, -3);
+  EXPECT_EQ(Eval("7 % 4").integer, 3);
+  EXPECT_DOUBLE_EQ(Eval("7 / 2.0").floating, 3.5);
+  EXPECT_TRUE(IsTrue(Eval("1 + 1 == 2 && 3 > 2")));
+  EXPECT_TRUE(IsTrue(Eval("false || !false")));
+  EXPECT_TRUE(IsTrue(Eval("not false and (true or false)")));
+  EXPECT_FALSE(IsTrue(Eval("1 < 2 == false")));
+}
+
+TEST_F(EvaluateTest, Variables)
+{
+  EXPECT_EQ(Eval("a * 2").integer, 6);
+  EXPECT_DOUBLE_EQ(Eval("x + a").floating, 4.5);
+  EXPECT_TRUE(IsTrue(Eval("a > 2 && b.status == 2")));
+  EXPECT_TRUE(IsTrue(Eval("arr[1] + arr[2] == 5 && flag")));
+
+  CompiledExpression expression{"a + a * b.status - arr[0]"};
+  ASSERT_EQ(expression.VariableNames().size(), 3);
+  EXPECT_EQ(expression.VariableNames()[0], "a");
+  EXPECT_EQ(expression.VariableNames()[1], "b.status");
+  EXPECT_EQ(expression.VariableNames()[2], "arr[0]");
+}
+
+TEST_F(EvaluateTest, ShortCircuit)
+{
+  // The undefined variable is never read
+  EXPECT_FALSE(IsTrue(Eval("a < 0 && undefined > 0")));
+  EXPECT_TRUE(IsTrue(Eval("a > 0 || undefined > 0")));
+
+  ExpressionValue result;
+  std::string error;
+  CompiledExpression expression{"a > 0 && undefined > 0"};
+  EXPECT_FALSE(expression.Evaluate(m_ws, result, error));
+  EXPECT_NE(error.find("undefined"), std::string::npos);
+}
+
+TEST_F(EvaluateTest, EvaluationErrors)
+{
+  ExpressionValue result;
+  std::string error;
+  EXPECT_FALSE(CompiledExpression{"a / zero"}.Evaluate(m_ws, result, error));
+  EXPECT_FALSE(CompiledExpression{"a % zero"}.Evaluate(m_ws, result, error));
+  EXPECT_FALSE(CompiledExpression{"b + 1"}.Evaluate(m_ws, result, error));
+  EXPECT_FALSE(CompiledExpression{"b.missing + 1"}.Evaluate(m_ws, result, error));
+  EXPECT_NE(error.find("b.missing"), std::string::npos);
+  EXPECT_FALSE(CompiledExpression{"arr[7] + 1"}.Evaluate(m_ws, result, error));
+  EXPECT_FALSE(CompiledExpression{}.Evaluate(m_ws, result, error));
+  EXPECT_TRUE(CompiledExpression{}.IsEmpty());
+}
+
+TEST_F(EvaluateTest, ParseErrors)
+{
+  EXPECT_THROW(CompiledExpression{""}, ParseException);
+  EXPECT_THROW(CompiledExpression{"  "}, ParseException);
+  EXPECT_THROW(CompiledExpression{"1 +"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"(1 + 2"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"1 + 2)"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"a = 1"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"a & b"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"a."}, ParseException);
+  EXPECT_THROW(CompiledExpression{"a[x]"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"12abc"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"1e"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"99999999999999999999"}, ParseException);
+  EXPECT_THROW(CompiledExpression{"and"}, ParseException);
+  // Constant subexpressions are evaluated during parsing
+  EXPECT_THROW(CompiledExpression{"a + 1 / 0"}, ParseException);
+  EXPECT_NO_THROW(CompiledExpression{"android || order || notify"});
+}
+
+TEST_F(EvaluateTest, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("Evaluate");
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  EXPECT_TRUE(instr->AddAttribute("expression", "a >"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  // Referenced variables need to exist in the workspace
+  EXPECT_TRUE(instr->SetAttribute("expression", "a > 1 && b.status == 2"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(proc.GetWorkspace().AddVariable(
+    "a", CreateLocalVariable(R"({"type":"int32"})", "3")));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(proc.GetWorkspace().AddVariable(
+    "b", CreateLocalVariable(
+           R"({"type":"status_t","attributes":[{"status":{"type":"uint8"}}]})",
+           R"({"status":2})")));
+  EXPECT_NO_THROW(instr->Setup(proc));
+}
+
+TEST_F(EvaluateTest, Procedure)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <Evaluate expression="a &gt; 3 &amp;&amp; b.status == 2"/>
+        <Inverter>
+            <Evaluate expression="a &lt; 3 || b.status != 2"/>
+        </Inverter>
+        <Evaluate expression="(a + b.status) * 2" outputVar="result"/>
+        <Equals leftVar="result" rightVar="expected"/>
+        <Evaluate expression="a &gt; 3 and b.status &gt;= 2" outputVar="flag"/>
+        <Condition varName="flag"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"int32"}' value='4' />
+        <Local name="b" type='{"type":"status_t","attributes":[{"status":{"type":"uint8"}}]}'
+               value='{"status":2}' />
+        <Local name="result" type='{"type":"uint32"}' value='0' />
+        <Local name="expected" type='{"type":"uint32"}' value='12' />
+        <Local name="flag" type='{"type":"bool"}' value='false' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST_F(EvaluateTest, ProcedureFailure)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <Evaluate expression="a / zero &gt; 1"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"int32"}' value='4' />
+        <Local name="zero" type='{"type":"int32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+EvaluateTest::EvaluateTest()
+  : m_ws{}
+{
+  EXPECT_TRUE(m_ws.AddVariable(
+    "a", CreateLocalVariable(R"({"type":"int32"})", "3")));
+  EXPECT_TRUE(m_ws.AddVariable(
+    "x", CreateLocalVariable(R"({"type":"float64"})", "1.5")));
+  EXPECT_TRUE(m_ws.AddVariable(
+    "zero", CreateLocalVariable(R"({"type":"uint64"})", "0")));
+  EXPECT_TRUE(m_ws.AddVariable(
+    "flag", CreateLocalVariable(R"({"type":"bool"})", "true")));
+  EXPECT_TRUE(m_ws.AddVariable(
+    "b", CreateLocalVariable(
+           R"({"type":"status_t","attributes":[{"status":{"type":"uint8"}}]})",
+           R"({"status":2})")));
+  EXPECT_TRUE(m_ws.AddVariable(
+    "arr", CreateLocalVariable(
+             R"({"type":"int_arr","element":{"type":"int16"}})", "[1,2,3]")));
+  m_ws.Setup();
+}
+
+EvaluateTest::~EvaluateTest() = default;
+
+ExpressionValue EvaluateTest::Eval(const std::string& expression)
+{
+  ExpressionValue result{};
+  std::string error;
+  EXPECT_TRUE(CompiledExpression{expression}.Evaluate(m_ws, result, error)) << error;
+  return result;
+}
+
+static std::unique_ptr<Variable> CreateLocalVariable(const std::string& type,
+                                                     const std::string& value)
+{
+  std::unique_ptr<Variable> var{new LocalVariable};
+  EXPECT_TRUE(var->AddAttribute("type", type));
+  EXPECT_TRUE(var->AddAttribute("value", value));
+  return var;
+}
@@ -98,3 +98,28 @@ TEST(Fallback, Procedure_failure)
   EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
   EXPECT_EQ(sup::UnitTestHelper::CounterInstruction::GetCount(), 2);
 }
+
+TEST(Fallback, Procedure_repeated)
+{
+  const std::string body{R"(
+    <Repeat maxCount="3">
+        <Fallback>
+            <Inverter name="failure">
+                <Counter/>
+            </Inverter>
+            <ForceSuccess name="success">
+                <Counter/>
+            </ForceSuccess>
+        </Fallback>
+    </Repeat>
+    <Workspace>
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+  EXPECT_EQ(sup::UnitTestHelper::CounterInstruction::GetCount(), 6);
+}
@@ -45,6 +45,16 @@ TEST(For, Setup)
   EXPECT_TRUE(instr->AddAttribute("elementVar", "i"));
   EXPECT_TRUE(instr->AddAttribute("arrayVar", "a"));
   EXPECT_NO_THROW(instr->Setup(proc));
+
+  // Array and range mode are mutually exclusive
+  EXPECT_TRUE(instr->AddAttribute("stop", "10"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  auto range_instr = GlobalInstructionRegistry().Create("For");
+  ASSERT_TRUE(AppendChildInstruction(*range_instr, GlobalInstructionRegistry().Create("Wait")));
+  EXPECT_TRUE(range_instr->AddAttribute("elementVar", "i"));
+  EXPECT_TRUE(range_instr->AddAttribute("stop", "10"));
+  EXPECT_NO_THROW(range_instr->Setup(proc));
 }
 
 TEST(For, Registration)
@@ -120,3 +130,87 @@ TEST(For, TypeMismatch)
   ASSERT_TRUE(proc.get() != nullptr);
   EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
 }
+
+TEST(For, ArraySnapshot)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <For elementVar="i" arrayVar="arr">
+            <Sequence>
+                <AddElement inputVar="i" outputVar="arr"/>
+                <Increment varName="count"/>
+            </Sequence>
+        </For>
+        <Equals leftVar="count" rightVar="three"/>
+    </Sequence>
+    <Workspace>
+    <Local name="arr" dynamicType="true" type='{"type":"uint32_arr","element":{"type":"uint32"}}' value="[2,4,6]"/>
+    <Local name="i" type='{"type":"uint32"}' value='0' />
+    <Local name="count" type='{"type":"uint32"}' value='0' />
+    <Local name="three" type='{"type":"uint32"}' value='3' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(For, Range)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <For elementVar="i" start="1" stop="10" step="3">
+            <Increment varName="count"/>
+        </For>
+        <Equals leftVar="count" rightVar="three"/>
+        <Equals leftVar="i" rightVar="seven"/>
+        <For elementVar="j" start="5" stop="0" step="-2">
+            <Increment varName="count"/>
+        </For>
+        <Equals leftVar="count" rightVar="six"/>
+        <Equals leftVar="j" rightVar="one"/>
+        <For elementVar="j" start="5" stop="5">
+            <Fail/>
+        </For>
+    </Sequence>
+    <Workspace>
+    <Local name="i" type='{"type":"uint32"}' value='0' />
+    <Local name="j" type='{"type":"int8"}' value='0' />
+    <Local name="count" type='{"type":"uint32"}' value='0' />
+    <Local name="one" type='{"type":"int8"}' value='1' />
+    <Local name="three" type='{"type":"uint32"}' value='3' />
+    <Local name="six" type='{"type":"uint32"}' value='6' />
+    <Local name="seven" type='{"type":"uint32"}' value='7' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(For, RangeZeroStep)
+{
+  const std::string body{
+    R"(
+    <For elementVar="i" stop="10" step="0">
+        <Succeed/>
+    </For>
+    <Workspace>
+    <Local name="i" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
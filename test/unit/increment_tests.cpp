@@ -141,3 +141,33 @@ TEST(Increment, IncrementBoolFailure)
   ASSERT_TRUE(proc.get() != nullptr);
   EXPECT_FALSE(sup::UnitTestHelper::TryAndExecute(proc, ui));
 }
+
+TEST(Increment, ConcurrentIncrements)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <ParallelSequence>
+            <Repeat maxCount="10">
+                <Increment varName="counter.value"/>
+            </Repeat>
+            <Repeat maxCount="10">
+                <Increment varName="counter.value"/>
+            </Repeat>
+        </ParallelSequence>
+        <Equals leftVar="counter.value" rightVar="expected"/>
+    </Sequence>
+    <Workspace>
+        <Local name="counter"
+               type='{"type":"counter_t","attributes":[{"value":{"type":"uint32"}}]}'
+               value='{"value":0}' />
+        <Local name="expected" type='{"type":"uint32"}' value='20' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
@@ -34,6 +34,27 @@
 using namespace sup::oac_tree;
 using namespace sup::oac_tree::Constants;
 
+/**
+ * @brief Plugin-style instruction that owns a child, but only overrides ChildInstructionsImpl.
+ */
+class PluginParentInstruction : public Instruction
+{
+public:
+  PluginParentInstruction()
+    : Instruction("PluginParentInstruction")
+    , m_child{sup::UnitTestHelper::CreateTestTreeInstruction("child")} {}
+  ~PluginParentInstruction() = default;
+  Category GetCategory() const override { return kDecorator; }
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface&, Workspace&) override {
+    return ExecutionStatus::SUCCESS;
+  }
+  std::vector<const Instruction*> ChildInstructionsImpl() const override {
+    return { m_child.get() };
+  }
+  std::unique_ptr<Instruction> m_child;
+};
+
 class InstructionInfoTest : public ::testing::Test
 {
 protected:
@@ -124,6 +145,19 @@ TEST_F(InstructionInfoTest, Flatten)
   EXPECT_EQ(indices, expected_indices);
 }
 
+TEST_F(InstructionInfoTest, PluginChildInstructions)
+{
+  // Children of instructions that only provide ChildInstructionsImpl are not skipped
+  PluginParentInstruction root{};
+  InstructionMap instr_map{std::addressof(root)};
+  EXPECT_EQ(instr_map.GetNumberOfInstructions(), 2u);
+  auto instr_info = utils::CreateInstructionInfoTree(root, instr_map);
+  EXPECT_NO_THROW(ValidateInstructionInfoTree(*instr_info));
+  ASSERT_EQ(instr_info->Children().size(), 1u);
+  EXPECT_EQ(instr_info->Children()[0]->GetType(), sup::UnitTestHelper::TestTreeInstruction::Type);
+  EXPECT_EQ(Flatten(*instr_info).size(), instr_map.GetNumberOfInstructions());
+}
+
 TEST_F(InstructionInfoTest, AppendChild)
 {
   {
@@ -244,6 +244,41 @@ R"RAW(
   EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
 }
 
+TEST_F(ListenTest, FieldUpdate)
+{
+  // Listening to a field reacts on updates of its parent variable
+  static const std::string procedure_body{
+R"RAW(
+    <ParallelSequence successThreshold="1" failureThreshold="2">
+        <Inverter>
+            <Listen varNames="live.x">
+                <Inverter>
+                    <Equals leftVar="live.x" rightVar="one"/>
+                </Inverter>
+            </Listen>
+        </Inverter>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Copy inputVar="one" outputVar="live.x"/>
+            <Wait timeout="5.0"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"live_t","attributes":[{"x":{"type":"uint64"}}]}'
+               value='{"x":0}' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)RAW"};
+
+  const auto procedure_string = sup::UnitTestHelper::CreateProcedureString(procedure_body);
+
+  sup::UnitTestHelper::EmptyUserInterface ui{};
+
+  auto proc = ParseProcedureString(procedure_string);
+  ASSERT_NE(proc.get(), nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
 TEST_F(ListenTest, VariableAttribute)
 {
   sup::UnitTestHelper::EmptyUserInterface ui;
@@ -57,6 +57,29 @@ const std::string DYNAMIC_TYPE_ATTRIBUTE = "dynamicType";
 
 // Function declaration
 
+TEST_F(LocalVariableTest, Snapshot)
+{
+  for (bool read_mostly : { false, true })
+  {
+    LocalVariable var{};
+    EXPECT_TRUE(var.AddAttribute(JSON_TYPE_ATTRIBUTE, R"RAW({"type":"uint64"})RAW"));
+    EXPECT_TRUE(var.AddAttribute(JSON_VALUE_ATTRIBUTE, "1"));
+    EXPECT_TRUE(var.AddAttribute(Constants::READ_MOSTLY_ATTRIBUTE_NAME, read_mostly ? "true" : "false"));
+    EXPECT_FALSE(var.GetSnapshot());
+    EXPECT_NO_THROW(var.Setup(ws));
+
+    // Snapshots are not affected by later writes
+    auto snapshot = var.GetSnapshot();
+    ASSERT_TRUE(snapshot);
+    EXPECT_EQ(snapshot->As<sup::dto::uint64>(), 1u);
+    EXPECT_TRUE(var.SetValue(sup::dto::AnyValue{sup::dto::UnsignedInteger64Type, 2}));
+    EXPECT_EQ(snapshot->As<sup::dto::uint64>(), 1u);
+
+    // In read-mostly mode, the stored value is shared instead of copied
+    EXPECT_EQ(var.GetSnapshot() == var.GetSnapshot(), read_mostly);
+  }
+}
+
 static std::string stob(bool b);
 
 // Global variables
@@ -402,6 +425,115 @@ TEST_F(LocalVariableTest, LegalTypeChange)
   }
 }
 
+TEST_F(LocalVariableTest, ReadMostly)
+{
+  const std::string struct_type =
+    R"RAW({"type":"counter_t","attributes":[{"count":{"type":"uint64"}},{"copy":{"type":"uint64"}}]})RAW";
+  LocalVariable var{};
+  EXPECT_TRUE(var.AddAttribute(JSON_TYPE_ATTRIBUTE, struct_type));
+  EXPECT_TRUE(var.AddAttribute(JSON_VALUE_ATTRIBUTE, R"RAW({"count":3,"copy":3})RAW"));
+  EXPECT_TRUE(var.AddAttribute(Constants::READ_MOSTLY_ATTRIBUTE_NAME, "true"));
+  EXPECT_NO_THROW(var.Setup(ws));
+
+  // Read and write complete value and fields
+  sup::dto::AnyValue value;
+  EXPECT_TRUE(var.GetValue(value));
+  EXPECT_EQ(value["count"].As<sup::dto::uint64>(), 3u);
+  sup::dto::AnyValue count{sup::dto::UnsignedInteger64Type, 4};
+  EXPECT_TRUE(var.SetValue(count, "count"));
+  EXPECT_TRUE(var.SetValue(count, "copy"));
+  sup::dto::AnyValue field;
+  EXPECT_TRUE(var.GetValue(field, "count"));
+  EXPECT_EQ(field.As<sup::dto::uint64>(), 4u);
+  EXPECT_FALSE(var.SetValue(sup::dto::AnyValue{"wrong type"}, "count"));
+  EXPECT_FALSE(var.GetValue(field, "unknown"));
+
+  // Readers always see a consistent snapshot while a writer updates both fields
+  const sup::dto::uint64 n_writes = 1000;
+  auto writer = std::async(std::launch::async, [&var, struct_type, n_writes]() {
+    for (sup::dto::uint64 i = 5; i < 5 + n_writes; ++i)
+    {
+      sup::dto::AnyValue new_value = {{
+        {"count", {sup::dto::UnsignedInteger64Type, i}},
+        {"copy", {sup::dto::UnsignedInteger64Type, i}}
+      }, "counter_t"};
+      if (!var.SetValue(new_value))
+      {
+        return false;
+      }
+    }
+    return true;
+  });
+  bool consistent = true;
+  for (int i = 0; i < 1000; ++i)
+  {
+    sup::dto::AnyValue read_back;
+    ASSERT_TRUE(var.GetValue(read_back));
+    consistent = consistent && (read_back["count"] == read_back["copy"]);
+  }
+  EXPECT_TRUE(writer.get());
+  EXPECT_TRUE(consistent);
+  EXPECT_TRUE(var.GetValue(field, "count"));
+  EXPECT_EQ(field.As<sup::dto::uint64>(), 4 + n_writes);
+
+  // Reset restores the initial value
+  var.Reset(ws);
+  EXPECT_TRUE(var.GetValue(field, "count"));
+  EXPECT_EQ(field.As<sup::dto::uint64>(), 3u);
+
+  // Teardown clears the value
+  var.Teardown();
+  EXPECT_FALSE(var.GetValue(value));
+}
+
+TEST_F(LocalVariableTest, UpdateValueInPlace)
+{
+  const std::string array_type =
+    R"RAW({"type":"uint64_arr","multiplicity":1,"element":{"type":"uint64"}})RAW";
+  LocalVariable var{};
+  EXPECT_TRUE(var.AddAttribute(JSON_TYPE_ATTRIBUTE, array_type));
+  EXPECT_TRUE(var.AddAttribute(JSON_VALUE_ATTRIBUTE, "[0]"));
+  EXPECT_TRUE(var.AddAttribute(Constants::IS_DYNAMIC_TYPE_ATTRIBUTE_NAME, "true"));
+  int n_notifications = 0;
+  var.SetNotifyCallback([&n_notifications](const sup::dto::AnyValue&, bool) {
+    ++n_notifications;
+  });
+  EXPECT_NO_THROW(var.Setup(ws));
+  n_notifications = 0;
+
+  // Each append notifies once
+  const sup::dto::uint64 n_appends = 100;
+  for (sup::dto::uint64 i = 1; i <= n_appends; ++i)
+  {
+    EXPECT_TRUE(var.UpdateValueInPlace([i](sup::dto::AnyValue& value) {
+      value.AddElement(sup::dto::AnyValue{sup::dto::UnsignedInteger64Type, i});
+      return true;
+    }));
+  }
+  EXPECT_EQ(n_notifications, n_appends);
+  sup::dto::AnyValue value;
+  EXPECT_TRUE(var.GetValue(value));
+  ASSERT_EQ(value.NumberOfElements(), n_appends + 1);
+  EXPECT_EQ(value[n_appends].As<sup::dto::uint64>(), n_appends);
+
+  // A failing update does not notify
+  EXPECT_FALSE(var.UpdateValueInPlace([](sup::dto::AnyValue&) { return false; }));
+  EXPECT_EQ(n_notifications, n_appends);
+
+  // Statically typed variables do not allow the type change of an append
+  LocalVariable static_var{};
+  EXPECT_TRUE(static_var.AddAttribute(JSON_TYPE_ATTRIBUTE, array_type));
+  EXPECT_TRUE(static_var.AddAttribute(JSON_VALUE_ATTRIBUTE, "[0]"));
+  EXPECT_NO_THROW(static_var.Setup(ws));
+  EXPECT_FALSE(static_var.UpdateValueInPlace([](sup::dto::AnyValue& value) {
+    value.AddElement(sup::dto::AnyValue{sup::dto::UnsignedInteger64Type, 1});
+    return true;
+  }));
+  sup::dto::AnyValue static_value;
+  EXPECT_TRUE(static_var.GetValue(static_value));
+  EXPECT_EQ(static_value.NumberOfElements(), 1);
+}
+
 static std::string stob(bool b)
 {
   std::stringstream str_s;
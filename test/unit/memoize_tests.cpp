@@ -0,0 +1,198 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+using namespace sup::oac_tree;
+
+TEST(Memoize, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("Memoize");
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->AddAttribute("inputVars", "a"));
+  // No child
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->InsertInstruction(GlobalInstructionRegistry().Create("Succeed"), 0));
+  EXPECT_NO_THROW(instr->Setup(proc));
+  EXPECT_TRUE(instr->AddAttribute("outputVars", "b"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+}
+
+TEST(Memoize, UnchangedInputs)
+{
+  // The child only runs the first time, later iterations replay the output.
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="4">
+            <Sequence>
+                <Memoize inputVars="a" outputVars="b">
+                    <Sequence>
+                        <Copy inputVar="a" outputVar="b"/>
+                        <Increment varName="counter"/>
+                    </Sequence>
+                </Memoize>
+                <Equals leftVar="a" rightVar="b"/>
+                <Copy inputVar="zero" outputVar="b"/>
+            </Sequence>
+        </Repeat>
+        <Equals leftVar="counter" rightVar="one"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='5' />
+        <Local name="b" type='{"type":"uint32"}' value='0' />
+        <Local name="zero" type='{"type":"uint32"}' value='0' />
+        <Local name="one" type='{"type":"uint32"}' value='1' />
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(Memoize, ChangedInputs)
+{
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="3">
+            <Sequence>
+                <Memoize inputVars="a" outputVars="b">
+                    <Sequence>
+                        <Copy inputVar="a" outputVar="b"/>
+                        <Increment varName="counter"/>
+                    </Sequence>
+                </Memoize>
+                <Equals leftVar="a" rightVar="b"/>
+                <Increment varName="a"/>
+            </Sequence>
+        </Repeat>
+        <Equals leftVar="counter" rightVar="three"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='5' />
+        <Local name="b" type='{"type":"uint32"}' value='0' />
+        <Local name="three" type='{"type":"uint32"}' value='3' />
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(Memoize, FailureCached)
+{
+  // A failure is replayed for unchanged inputs, without running the child again.
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="3">
+            <ForceSuccess>
+                <Memoize inputVars="a">
+                    <Sequence>
+                        <Increment varName="counter"/>
+                        <Fail/>
+                    </Sequence>
+                </Memoize>
+            </ForceSuccess>
+        </Repeat>
+        <Equals leftVar="counter" rightVar="one"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='5' />
+        <Local name="one" type='{"type":"uint32"}' value='1' />
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(Memoize, FailureNotCachedForChangedInputs)
+{
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="3">
+            <Sequence>
+                <ForceSuccess>
+                    <Memoize inputVars="a">
+                        <Sequence>
+                            <Increment varName="counter"/>
+                            <Fail/>
+                        </Sequence>
+                    </Memoize>
+                </ForceSuccess>
+                <Increment varName="a"/>
+            </Sequence>
+        </Repeat>
+        <Equals leftVar="counter" rightVar="three"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='5' />
+        <Local name="three" type='{"type":"uint32"}' value='3' />
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(Memoize, MissingInput)
+{
+  // The child is not executed when an input can't be read
+  const std::string body{R"(
+    <Sequence>
+        <Inverter>
+            <Memoize inputVars="a,does_not_exist">
+                <Increment varName="counter"/>
+            </Memoize>
+        </Inverter>
+        <Equals leftVar="counter" rightVar="zero"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint32"}' value='5' />
+        <Local name="zero" type='{"type":"uint32"}' value='0' />
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
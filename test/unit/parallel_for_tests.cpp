@@ -0,0 +1,235 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace sup::oac_tree;
+
+TEST(ParallelFor, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("ParallelFor");
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  ASSERT_TRUE(AppendChildInstruction(*instr, GlobalInstructionRegistry().Create("Succeed")));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+
+  EXPECT_TRUE(instr->AddAttribute("elementVar", "i"));
+  EXPECT_TRUE(instr->AddAttribute("arrayVar", "a"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+
+  EXPECT_TRUE(instr->AddAttribute("maxConcurrency", "0"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->SetAttribute("maxConcurrency", "3"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+}
+
+TEST(ParallelFor, ThreadedChildren)
+{
+  // Element bindings are per thread, so children that spawn threads of their own are rejected
+  const std::string body{
+    R"(
+    <ParallelFor elementVar="i" arrayVar="arr">
+        <Sequence>
+            <Copy inputVar="i" outputVar="copy"/>
+            <ParallelSequence>
+                <Equals leftVar="i" rightVar="copy"/>
+                <Wait timeout="0.01"/>
+            </ParallelSequence>
+        </Sequence>
+    </ParallelFor>
+    <Workspace>
+        <Local name="arr" type='{"type":"uint32_arr","element":{"type":"uint32"}}'
+               value="[1,2,3]"/>
+        <Local name="i" type='{"type":"uint32"}' value='0' />
+        <Local name="copy" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_THROW(proc->Setup(), InstructionSetupException);
+
+  Procedure empty_proc;
+  for (const std::string type : { "Async", "ParallelFor" })
+  {
+    auto instr = GlobalInstructionRegistry().Create("ParallelFor");
+    EXPECT_TRUE(instr->AddAttribute("elementVar", "i"));
+    EXPECT_TRUE(instr->AddAttribute("arrayVar", "a"));
+    auto inverter = GlobalInstructionRegistry().Create("Inverter");
+    auto threaded = GlobalInstructionRegistry().Create(type);
+    ASSERT_TRUE(AppendChildInstruction(*threaded, GlobalInstructionRegistry().Create("Succeed")));
+    if (type == "ParallelFor")
+    {
+      EXPECT_TRUE(threaded->AddAttribute("elementVar", "j"));
+      EXPECT_TRUE(threaded->AddAttribute("arrayVar", "b"));
+    }
+    ASSERT_TRUE(AppendChildInstruction(*inverter, std::move(threaded)));
+    ASSERT_TRUE(AppendChildInstruction(*instr, std::move(inverter)));
+    EXPECT_THROW(instr->Setup(empty_proc), InstructionSetupException) << "Type: " << type;
+  }
+}
+
+TEST(ParallelFor, Success)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <ParallelFor elementVar="i" arrayVar="arr" maxConcurrency="3">
+            <Sequence>
+                <GreaterThan leftVar="i" rightVar="zero"/>
+                <Wait timeout="0.01"/>
+                <Increment varName="count"/>
+            </Sequence>
+        </ParallelFor>
+        <Equals leftVar="count" rightVar="expected"/>
+        <Equals leftVar="i" rightVar="zero"/>
+    </Sequence>
+    <Workspace>
+        <Local name="arr" type='{"type":"uint32_arr","element":{"type":"uint32"}}'
+               value="[1,2,3,4,5,6,7,8,9,10]"/>
+        <Local name="i" type='{"type":"uint32"}' value='0' />
+        <Local name="zero" type='{"type":"uint32"}' value='0' />
+        <Local name="count" type='{"type":"uint32"}' value='0' />
+        <Local name="expected" type='{"type":"uint32"}' value='10' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(ParallelFor, Thresholds)
+{
+  const std::string body{
+    R"(
+    <Sequence>
+        <ParallelFor elementVar="i" arrayVar="arr" successThreshold="THRESHOLD"
+                     failureThreshold="6">
+            <Equals leftVar="i" rightVar="target"/>
+        </ParallelFor>
+    </Sequence>
+    <Workspace>
+        <Local name="arr" type='{"type":"uint32_arr","element":{"type":"uint32"}}'
+               value="[1,2,3,4,5,6]"/>
+        <Local name="i" type='{"type":"uint32"}' value='0' />
+        <Local name="target" type='{"type":"uint32"}' value='4' />
+    </Workspace>
+)"};
+
+  auto create_body = [&body](const std::string& threshold)
+  {
+    auto result = body;
+    result.replace(result.find("THRESHOLD"), 9, threshold);
+    return result;
+  };
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  {
+    // Only one element matches the target
+    auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(create_body("1")));
+    ASSERT_TRUE(proc.get() != nullptr);
+    EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+  }
+  {
+    auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(create_body("2")));
+    ASSERT_TRUE(proc.get() != nullptr);
+    EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  }
+}
+
+TEST(ParallelFor, HaltReleasesRunningWorkers)
+{
+  // Element 1 fails immediately, while element 2 keeps running until its worker is halted
+  const std::string body{
+    R"(
+    <ParallelFor elementVar="i" arrayVar="arr" maxConcurrency="2">
+        <Sequence>
+            <Equals leftVar="i" rightVar="target"/>
+            <Periodic period="0.01" maxCount="1000" blocking="false">
+                <Succeed/>
+            </Periodic>
+        </Sequence>
+    </ParallelFor>
+    <Workspace>
+        <Local name="arr" type='{"type":"uint32_arr","element":{"type":"uint32"}}' value="[1,2]"/>
+        <Local name="i" type='{"type":"uint32"}' value='0' />
+        <Local name="target" type='{"type":"uint32"}' value='2' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  // Running workers are polled with the timing accuracy of the procedure
+  EXPECT_TRUE(proc->AddAttribute("timingAccuracy", "5.0"));
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+}
+
+TEST(ParallelFor, EmptyArray)
+{
+  const std::string body{
+    R"(
+    <ParallelFor elementVar="i" arrayVar="arr">
+        <Fail/>
+    </ParallelFor>
+    <Workspace>
+        <Local name="arr" type='{"type":"uint32_arr","element":{"type":"uint32"}}' value="[]"/>
+        <Local name="i" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(ParallelFor, TypeMismatch)
+{
+  const std::string body{
+    R"(
+    <ParallelFor elementVar="i" arrayVar="arr">
+        <Succeed/>
+    </ParallelFor>
+    <Workspace>
+        <Local name="arr" type='{"type":"uint32_arr","element":{"type":"uint32"}}' value="[2,4,6]"/>
+        <Local name="i" type='{"type":"float32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
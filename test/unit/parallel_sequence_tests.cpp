@@ -33,6 +33,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
 
 using namespace sup::oac_tree;
 
@@ -121,3 +122,122 @@ TEST(ParallelSequence, SetupImpl_thresholds)
   Procedure proc;
   EXPECT_THROW(parallel->Setup(proc), InstructionSetupException);
 }
+
+const std::string ParallelBranchesBody{R"(
+    <Sequence>
+        <ParallelSequence executionMode="MODE">
+            <Sequence>
+                <Increment varName="a"/>
+                <Increment varName="a"/>
+            </Sequence>
+            <Sequence>
+                <Increment varName="b"/>
+                <Wait timeout="0.05"/>
+                <Increment varName="b"/>
+            </Sequence>
+            <Increment varName="c"/>
+        </ParallelSequence>
+        <Equals leftVar="a" rightVar="two"/>
+        <Equals leftVar="b" rightVar="two"/>
+        <Equals leftVar="c" rightVar="one"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint8"}' value='0' />
+        <Local name="b" type='{"type":"uint8"}' value='0' />
+        <Local name="c" type='{"type":"uint8"}' value='0' />
+        <Local name="one" type='{"type":"uint8"}' value='1' />
+        <Local name="two" type='{"type":"uint8"}' value='2' />
+    </Workspace>
+)"};
+
+TEST(ParallelSequence, BranchesWithMultipleTicks)
+{
+  for (const std::string mode : { "threads", "auto", "adaptive" })
+  {
+    auto body = ParallelBranchesBody;
+    body.replace(body.find("MODE"), 4, mode);
+    sup::UnitTestHelper::EmptyUserInterface ui;
+    auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+    ASSERT_TRUE(proc.get() != nullptr);
+    EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui)) << "Execution mode: " << mode;
+  }
+}
+
+TEST(ParallelSequence, ExecutionMode)
+{
+  // Non-blocking trait
+  EXPECT_TRUE(GlobalInstructionRegistry().Create("Copy")->IsNonBlocking());
+  EXPECT_TRUE(GlobalInstructionRegistry().Create("ParallelSequence")->IsNonBlocking());
+  EXPECT_FALSE(GlobalInstructionRegistry().Create("Wait")->IsNonBlocking());
+  auto sequence = GlobalInstructionRegistry().Create("Sequence");
+  EXPECT_TRUE(AppendChildInstruction(*sequence, GlobalInstructionRegistry().Create("Succeed")));
+  EXPECT_TRUE(sequence->IsNonBlocking());
+  EXPECT_TRUE(AppendChildInstruction(*sequence, GlobalInstructionRegistry().Create("Wait")));
+  EXPECT_FALSE(sequence->IsNonBlocking());
+
+  // Decorators are blocking unless they only forward ticks to a non-blocking child
+  auto inverter = GlobalInstructionRegistry().Create("Inverter");
+  EXPECT_FALSE(inverter->IsNonBlocking());
+  EXPECT_TRUE(AppendChildInstruction(*inverter, GlobalInstructionRegistry().Create("Copy")));
+  EXPECT_TRUE(inverter->IsNonBlocking());
+  auto periodic = GlobalInstructionRegistry().Create("Periodic");
+  EXPECT_TRUE(AppendChildInstruction(*periodic, GlobalInstructionRegistry().Create("Copy")));
+  EXPECT_TRUE(periodic->IsNonBlocking());
+  EXPECT_TRUE(periodic->AddAttribute("blocking", "true"));
+  EXPECT_FALSE(periodic->IsNonBlocking());
+  EXPECT_TRUE(periodic->SetAttribute("blocking", "false"));
+  EXPECT_TRUE(periodic->IsNonBlocking());
+
+  // Unknown execution mode
+  auto parallel = GlobalInstructionRegistry().Create("ParallelSequence");
+  EXPECT_TRUE(AppendChildInstruction(*parallel, GlobalInstructionRegistry().Create("Succeed")));
+  EXPECT_TRUE(parallel->AddAttribute("executionMode", "undefined"));
+  Procedure proc;
+  EXPECT_THROW(parallel->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(parallel->SetAttribute("executionMode", "adaptive"));
+  EXPECT_NO_THROW(parallel->Setup(proc));
+}
+
+TEST(ParallelSequence, BlockingPeriodicBranch)
+{
+  // A blocking Periodic branch must not run inline, as it would stall the other branches
+  const std::string body{R"(
+    <ParallelSequence>
+        <Periodic period="1.0" maxCount="3" blocking="true">
+            <Copy inputVar="a" outputVar="b"/>
+        </Periodic>
+        <Fail/>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint8"}' value='1' />
+        <Local name="b" type='{"type":"uint8"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(800));
+}
+
+TEST(ParallelSequence, FailureThreshold)
+{
+  const std::string body{R"(
+    <ParallelSequence failureThreshold="2">
+        <Fail/>
+        <Wait timeout="10.0"/>
+        <Sequence>
+            <Succeed/>
+            <Fail/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace/>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
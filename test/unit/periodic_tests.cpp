@@ -0,0 +1,194 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace sup::oac_tree;
+
+TEST(Periodic, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("Periodic");
+  EXPECT_TRUE(instr->InsertInstruction(GlobalInstructionRegistry().Create("Succeed"), 0));
+  // Missing period
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->AddAttribute("period", "0.1"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+  EXPECT_TRUE(instr->AddAttribute("overrunPolicy", "catchUp"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+  EXPECT_TRUE(instr->SetAttribute("overrunPolicy", "sometimes"));
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+}
+
+TEST(Periodic, FixedDeadlines)
+{
+  const std::string body{R"(
+    <Periodic period="0.02" maxCount="5" blocking="true" statsVar="stats">
+        <Increment varName="counter"/>
+    </Periodic>
+    <Workspace>
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+        <Local name="stats" />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::SUCCESS));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  sup::dto::AnyValue stats;
+  ASSERT_TRUE(proc->GetWorkspace().GetValue("stats", stats));
+  // First activation is immediate, the last one four periods later:
+  EXPECT_GE(elapsed, std::chrono::milliseconds(80));
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+  EXPECT_EQ(stats["iterations"].As<sup::dto::uint64>(), 5u);
+  EXPECT_EQ(stats["overruns"].As<sup::dto::uint64>(), 0u);
+  EXPECT_EQ(stats["skipped"].As<sup::dto::uint64>(), 0u);
+  EXPECT_LE(stats["mean_jitter_ns"].As<sup::dto::uint64>(),
+            stats["max_jitter_ns"].As<sup::dto::uint64>());
+}
+
+TEST(Periodic, OverrunSkip)
+{
+  const std::string body{R"(
+    <Periodic period="0.02" maxCount="2" blocking="true" statsVar="stats">
+        <Wait timeout="0.05" blocking="true"/>
+    </Periodic>
+    <Workspace>
+        <Local name="stats" />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::SUCCESS));
+  sup::dto::AnyValue stats;
+  ASSERT_TRUE(proc->GetWorkspace().GetValue("stats", stats));
+  EXPECT_EQ(stats["iterations"].As<sup::dto::uint64>(), 2u);
+  EXPECT_EQ(stats["overruns"].As<sup::dto::uint64>(), 2u);
+  EXPECT_GE(stats["skipped"].As<sup::dto::uint64>(), 4u);
+}
+
+TEST(Periodic, OverrunCatchUp)
+{
+  const std::string body{R"(
+    <Periodic period="0.02" maxCount="2" blocking="true" overrunPolicy="catchUp" statsVar="stats">
+        <Wait timeout="0.05" blocking="true"/>
+    </Periodic>
+    <Workspace>
+        <Local name="stats" />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::SUCCESS));
+  sup::dto::AnyValue stats;
+  ASSERT_TRUE(proc->GetWorkspace().GetValue("stats", stats));
+  EXPECT_EQ(stats["iterations"].As<sup::dto::uint64>(), 2u);
+  EXPECT_EQ(stats["overruns"].As<sup::dto::uint64>(), 2u);
+  EXPECT_EQ(stats["skipped"].As<sup::dto::uint64>(), 0u);
+  // The second activation was late by at least the overrun of the first:
+  EXPECT_GE(stats["max_jitter_ns"].As<sup::dto::uint64>(), 20000000u);
+}
+
+TEST(Periodic, OverrunFail)
+{
+  const std::string body{R"(
+    <Periodic period="0.02" maxCount="5" overrunPolicy="fail" statsVar="stats">
+        <Wait timeout="0.05" blocking="true"/>
+    </Periodic>
+    <Workspace>
+        <Local name="stats" />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::FAILURE));
+  sup::dto::AnyValue stats;
+  ASSERT_TRUE(proc->GetWorkspace().GetValue("stats", stats));
+  EXPECT_EQ(stats["iterations"].As<sup::dto::uint64>(), 1u);
+  EXPECT_EQ(stats["overruns"].As<sup::dto::uint64>(), 1u);
+}
+
+TEST(Periodic, ChildFailure)
+{
+  const std::string body{R"(
+    <Periodic period="0.01" phase="0.01" statsVar="stats">
+        <Sequence>
+            <Increment varName="counter"/>
+            <Fail/>
+        </Sequence>
+    </Periodic>
+    <Workspace>
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+        <Local name="stats" />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::FAILURE));
+  sup::dto::AnyValue counter;
+  EXPECT_TRUE(proc->GetWorkspace().GetValue("counter", counter));
+  EXPECT_EQ(counter.As<sup::dto::uint32>(), 1u);
+  // No statistics were published
+  sup::dto::AnyValue stats;
+  EXPECT_FALSE(proc->GetWorkspace().GetValue("stats", stats));
+}
+
+TEST(Periodic, NonBlocking)
+{
+  const std::string body{R"(
+    <Periodic period="0.05" maxCount="3" statsVar="stats">
+        <Increment varName="counter"/>
+    </Periodic>
+    <Workspace>
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+        <Local name="stats" />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::SUCCESS));
+  sup::dto::AnyValue stats;
+  ASSERT_TRUE(proc->GetWorkspace().GetValue("stats", stats));
+  EXPECT_EQ(stats["iterations"].As<sup::dto::uint64>(), 3u);
+}
@@ -83,3 +83,37 @@ TEST(ReactiveSequence, Setup)
   Procedure proc;
   EXPECT_NO_THROW(reactive_seq->Setup(proc));
 }
+
+TEST(ReactiveSequence, ResetOnlyExecutedChildren)
+{
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  Procedure proc;
+  Workspace ws;
+  auto reactive = GlobalInstructionRegistry().Create("ReactiveSequence");
+  auto first = std::make_unique<sup::UnitTestHelper::ResetCounterInstruction>(
+    ExecutionStatus::SUCCESS);
+  auto first_ptr = first.get();
+  auto wait = GlobalInstructionRegistry().Create("Wait");
+  EXPECT_TRUE(wait->AddAttribute("timeout", "10.0"));
+  auto last = std::make_unique<sup::UnitTestHelper::ResetCounterInstruction>(
+    ExecutionStatus::SUCCESS);
+  auto last_ptr = last.get();
+  ASSERT_TRUE(AppendChildInstruction(*reactive, std::move(first)));
+  ASSERT_TRUE(AppendChildInstruction(*reactive, std::move(wait)));
+  ASSERT_TRUE(AppendChildInstruction(*reactive, std::move(last)));
+  EXPECT_NO_THROW(reactive->Setup(proc));
+
+  // The first child is reset each time the running child is reached, the last child never
+  for (int i = 0; i < 6; ++i)
+  {
+    reactive->ExecuteSingle(ui, ws);
+  }
+  EXPECT_EQ(reactive->GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(first_ptr->GetResetCount(), 3u);
+  EXPECT_EQ(last_ptr->GetResetCount(), 0u);
+
+  reactive->Halt();
+  reactive->Reset(ui);
+  EXPECT_EQ(first_ptr->GetResetCount(), 4u);
+  EXPECT_EQ(last_ptr->GetResetCount(), 1u);
+}
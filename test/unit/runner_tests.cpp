@@ -119,6 +119,25 @@ const std::string AsyncWaitProcedureString =
 </Procedure>
 )RAW";
 
+const std::string RepeatProcedureString =
+    R"RAW(<?xml version="1.0" encoding="UTF-8"?>
+<Procedure xmlns="http://codac.iter.org/sup/oac-tree" version="1.0"
+           name="Synchronous loop for testing purposes"
+           xmlns:xs="http://www.w3.org/2001/XMLSchema-instance"
+           xs:schemaLocation="http://codac.iter.org/sup/oac-tree oac-tree.xsd"
+           maxMicroTicks="1000">
+    <Repeat maxCount="5">
+        <Sequence>
+            <Wait name="First"/>
+            <Wait name="Second"/>
+            <Inverter name="Invert failure">
+                <Fail/>
+            </Inverter>
+        </Sequence>
+    </Repeat>
+</Procedure>
+)RAW";
+
 using ::testing::_;
 using ::testing::AtLeast;
 using ::testing::Exactly;
@@ -464,3 +483,75 @@ RunnerTest::RunnerTest()
 {}
 
 RunnerTest::~RunnerTest() = default;
+
+TEST_F(RunnerTest, MicroTicks)
+{
+  auto proc = ParseProcedureString(RepeatProcedureString);
+  ASSERT_NE(proc.get(), nullptr);
+  EXPECT_EQ(MaxMicroTicks(*proc), 1000u);
+  EXPECT_EQ(MaxMicroTicks(*sync_proc), 1u);
+  EXPECT_NO_THROW(proc->Setup());
+  Runner runner(empty_ui);
+  EXPECT_NO_THROW(runner.SetProcedure(proc.get()));
+  int n_ticks = 0;
+  runner.SetTickCallback([&n_ticks](const Procedure&) { ++n_ticks; });
+
+  // One step per tick
+  EXPECT_NO_THROW(runner.ExecuteProcedure());
+  EXPECT_TRUE(runner.IsFinished());
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::SUCCESS);
+  const int n_single_steps = n_ticks;
+  EXPECT_GT(n_single_steps, 5);
+
+  // Run to block: the synchronous procedure finishes in a single tick
+  proc->Reset(empty_ui);
+  n_ticks = 0;
+  runner.SetMaxMicroTicks(MaxMicroTicks(*proc));
+  EXPECT_NO_THROW(runner.ExecuteProcedure());
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(n_ticks, 1);
+
+  // The number of steps per tick is capped
+  proc->Reset(empty_ui);
+  n_ticks = 0;
+  runner.SetMaxMicroTicks(2);
+  EXPECT_NO_THROW(runner.ExecuteProcedure());
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(n_ticks, (n_single_steps + 1) / 2);
+}
+
+TEST_F(RunnerTest, MicroTicksBreakpoint)
+{
+  Runner runner(empty_ui);
+  EXPECT_NO_THROW(sync_proc->Setup());
+  EXPECT_NO_THROW(runner.SetProcedure(sync_proc.get()));
+  runner.SetMaxMicroTicks(100);
+  int n_ticks = 0;
+  runner.SetTickCallback([&n_ticks](const Procedure&) { ++n_ticks; });
+
+  // Execute the first step to expose the Inverter as a next instruction
+  EXPECT_NO_THROW(runner.ExecuteSingle());
+  auto next_instructions = GetNextInstructions(*sync_proc);
+  auto predicate = [](const Instruction* instruction) {
+    return instruction->GetType() == "Inverter";
+  };
+  auto it = std::find_if(next_instructions.begin(), next_instructions.end(), predicate);
+  ASSERT_NE(it, next_instructions.end());
+  EXPECT_NO_THROW(runner.SetBreakpoint(*it));
+  sync_proc->Reset(empty_ui);
+  n_ticks = 0;
+
+  // The breakpoint is hit within the first tick
+  EXPECT_NO_THROW(runner.ExecuteProcedure());
+  EXPECT_FALSE(runner.IsFinished());
+  EXPECT_EQ(n_ticks, 1);
+  auto breakpoint_instructions = runner.GetCurrentBreakpointInstructions();
+  ASSERT_EQ(breakpoint_instructions.size(), 1);
+  EXPECT_EQ(breakpoint_instructions[0], *it);
+
+  // Continuing passes the breakpoint and finishes within the next tick
+  EXPECT_NO_THROW(runner.ExecuteProcedure());
+  EXPECT_TRUE(runner.IsFinished());
+  EXPECT_EQ(sync_proc->GetStatus(), ExecutionStatus::FAILURE);
+  EXPECT_EQ(n_ticks, 2);
+}
@@ -59,3 +59,27 @@ TEST(SequenceWorkspace, CopyVariable)
   proc->ExecuteSingle(ui);
   EXPECT_EQ(proc->GetStatus(), ExecutionStatus::SUCCESS);
 }
+
+TEST(SequenceWorkspace, RepeatedSequence)
+{
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="3">
+            <Sequence>
+                <Increment varName="a"/>
+                <Increment varName="a"/>
+            </Sequence>
+        </Repeat>
+        <Equals leftVar="a" rightVar="six"/>
+    </Sequence>
+    <Workspace>
+        <Local name="a" type='{"type":"uint8"}' value='0' />
+        <Local name="six" type='{"type":"uint8"}' value='6' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
@@ -0,0 +1,144 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - oac-tree
+ *
+ * Description   : oac-tree for operational procedures
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "unit_test_helper.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/runner.h>
+#include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace sup::oac_tree;
+
+TEST(Timeout, Setup)
+{
+  Procedure proc;
+  auto instr = GlobalInstructionRegistry().Create("Timeout");
+  EXPECT_TRUE(instr->InsertInstruction(GlobalInstructionRegistry().Create("Succeed"), 0));
+  // Missing timeout
+  EXPECT_THROW(instr->Setup(proc), InstructionSetupException);
+  EXPECT_TRUE(instr->AddAttribute("timeout", "1.0"));
+  EXPECT_NO_THROW(instr->Setup(proc));
+}
+
+TEST(Timeout, ChildFinishesInTime)
+{
+  const std::string body{R"(
+    <Timeout timeout="2.0">
+        <Wait timeout="0.05"/>
+    </Timeout>
+    <Workspace/>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
+}
+
+TEST(Timeout, ChildFailure)
+{
+  const std::string body{R"(
+    <Timeout timeout="2.0">
+        <Fail/>
+    </Timeout>
+    <Workspace/>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST(Timeout, BlockingChildHalted)
+{
+  // The blocking child is woken up by the halt when the deadline expires.
+  const std::string body{R"(
+    <Timeout timeout="0.1">
+        <Wait timeout="10.0" blocking="true"/>
+    </Timeout>
+    <Workspace/>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+}
+
+TEST(Timeout, RunningChildWakesRunner)
+{
+  // The expired deadline requests a tick, so the runner does not wait for its long tick timeout.
+  const std::string body{R"(
+    <Timeout timeout="0.1">
+        <Wait timeout="10.0"/>
+    </Timeout>
+    <Workspace/>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc);
+  Runner runner{ui};
+  runner.SetProcedure(proc.get());
+  runner.SetTickCallback(TimeoutWhenRunning(5000000000));
+  auto start = std::chrono::steady_clock::now();
+  runner.ExecuteProcedure();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::FAILURE);
+}
+
+TEST(Timeout, Repeated)
+{
+  // Each iteration arms a new deadline after the reset of the previous one.
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="3">
+            <Timeout timeout="1.0">
+                <Increment varName="counter"/>
+            </Timeout>
+        </Repeat>
+        <Timeout timeout="0.05">
+            <Wait timeout="0.5" blocking="true"/>
+        </Timeout>
+    </Sequence>
+    <Workspace>
+        <Local name="counter" type='{"type":"uint32"}' value='0' />
+    </Workspace>
+)"};
+
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  auto proc = ParseProcedureString(sup::UnitTestHelper::CreateProcedureString(body));
+  ASSERT_TRUE(proc.get() != nullptr);
+  EXPECT_TRUE(sup::UnitTestHelper::TryAndExecuteNoReset(proc, ui, ExecutionStatus::FAILURE));
+  sup::dto::AnyValue counter;
+  EXPECT_TRUE(proc->GetWorkspace().GetValue("counter", counter));
+  EXPECT_EQ(counter.As<sup::dto::uint32>(), 3u);
+}
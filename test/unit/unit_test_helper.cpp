@@ -53,6 +53,8 @@ unsigned long CounterInstruction::counter = 0u;
 
 static bool _initialise_instruction = RegisterGlobalInstruction<CounterInstruction>();
 
+const std::string ResetCounterInstruction::Type = "ResetCounter";
+
 const std::string TestTreeInstruction::Type = "TestTreeInstruction";
 
 CounterInstruction::CounterInstruction()
@@ -83,6 +85,29 @@ ExecutionStatus CounterInstruction::ExecuteSingleImpl(UserInterface& ui, Workspa
   return ExecutionStatus::SUCCESS;
 }
 
+ResetCounterInstruction::ResetCounterInstruction(ExecutionStatus result)
+  : Instruction(ResetCounterInstruction::Type)
+  , m_result{result}
+  , m_reset_count{0u}
+{}
+
+ResetCounterInstruction::~ResetCounterInstruction() = default;
+
+unsigned long ResetCounterInstruction::GetResetCount() const
+{
+  return m_reset_count;
+}
+
+ExecutionStatus ResetCounterInstruction::ExecuteSingleImpl(UserInterface&, Workspace&)
+{
+  return m_result;
+}
+
+void ResetCounterInstruction::ResetHook(UserInterface&)
+{
+  ++m_reset_count;
+}
+
 TestTreeInstruction::TestTreeInstruction()
   : CompoundInstruction(TestTreeInstruction::Type)
 {}
@@ -73,6 +73,25 @@ private:
                                                     sup::oac_tree::Workspace& ws) override;
 };
 
+class ResetCounterInstruction : public sup::oac_tree::Instruction
+{
+public:
+  explicit ResetCounterInstruction(sup::oac_tree::ExecutionStatus result);
+  ~ResetCounterInstruction() override;
+
+  static const std::string Type;
+
+  unsigned long GetResetCount() const;
+
+private:
+  sup::oac_tree::ExecutionStatus ExecuteSingleImpl(sup::oac_tree::UserInterface& ui,
+                                                    sup::oac_tree::Workspace& ws) override;
+  void ResetHook(sup::oac_tree::UserInterface& ui) override;
+
+  sup::oac_tree::ExecutionStatus m_result;
+  unsigned long m_reset_count;
+};
+
 class TestTreeInstruction : public sup::oac_tree::CompoundInstruction
 {
 public:
@@ -171,14 +190,16 @@ static inline bool TryAndExecute(
     std::unique_ptr<sup::oac_tree::Procedure>& proc, sup::oac_tree::UserInterface& ui,
     const sup::oac_tree::ExecutionStatus& expect = sup::oac_tree::ExecutionStatus::SUCCESS);
 
-static inline bool TryAndExecuteNoReset(std::unique_ptr<sup::oac_tree::Procedure>& proc,
-                                        sup::oac_tree::UserInterface& ui,
-                                        const sup::oac_tree::ExecutionStatus& expect)
+/**
+ * Executes a procedure that was already set up until it finishes, e.g. to register workspace
+ * callbacks only after the variables notified their initial values.
+ */
+static inline bool ExecuteAfterSetup(std::unique_ptr<sup::oac_tree::Procedure>& proc,
+                                     sup::oac_tree::UserInterface& ui,
+                                     const sup::oac_tree::ExecutionStatus& expect)
 {
   bool status = static_cast<bool>(proc);
 
-  proc->Setup();
-
   if (status)
   {
     sup::oac_tree::ExecutionStatus exec = sup::oac_tree::ExecutionStatus::FAILURE;
@@ -200,6 +221,14 @@ static inline bool TryAndExecuteNoReset(std::unique_ptr<sup::oac_tree::Procedure
   return status;
 }
 
+static inline bool TryAndExecuteNoReset(std::unique_ptr<sup::oac_tree::Procedure>& proc,
+                                        sup::oac_tree::UserInterface& ui,
+                                        const sup::oac_tree::ExecutionStatus& expect)
+{
+  proc->Setup();
+  return ExecuteAfterSetup(proc, ui, expect);
+}
+
 static inline bool TryAndExecute(std::unique_ptr<sup::oac_tree::Procedure>& proc,
                                  sup::oac_tree::UserInterface& ui,
                                  const sup::oac_tree::ExecutionStatus& expect)
@@ -31,6 +31,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
 
 using namespace sup::oac_tree;
 
@@ -75,6 +78,44 @@ R"RAW(
   EXPECT_TRUE(sup::UnitTestHelper::TryAndExecute(proc, ui));
 }
 
+TEST(Wait, BlockingAccuracy)
+{
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  Procedure proc;
+  Workspace ws;
+  Wait instruction;
+  EXPECT_TRUE(instruction.AddAttribute("timeout", "0.02"));
+  EXPECT_TRUE(instruction.AddAttribute("blocking", "true"));
+  EXPECT_NO_THROW(instruction.Setup(proc));
+  auto start = std::chrono::steady_clock::now();
+  instruction.ExecuteSingle(ui, ws);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(instruction.GetStatus(), ExecutionStatus::SUCCESS);
+  EXPECT_GE(elapsed, std::chrono::milliseconds(20));
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+}
+
+TEST(Wait, BlockingHalt)
+{
+  sup::UnitTestHelper::EmptyUserInterface ui;
+  Procedure proc;
+  Workspace ws;
+  Wait instruction;
+  EXPECT_TRUE(instruction.AddAttribute("timeout", "60.0"));
+  EXPECT_TRUE(instruction.AddAttribute("blocking", "true"));
+  EXPECT_NO_THROW(instruction.Setup(proc));
+  auto start = std::chrono::steady_clock::now();
+  auto execution = std::async(std::launch::async, [&instruction, &ui, &ws]() {
+    instruction.ExecuteSingle(ui, ws);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  instruction.Halt();
+  execution.get();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(instruction.GetStatus(), ExecutionStatus::FAILURE);
+  EXPECT_LT(elapsed, std::chrono::seconds(5));
+}
+
 TEST(Wait, VariableTimeout)
 {
   sup::UnitTestHelper::EmptyUserInterface ui;
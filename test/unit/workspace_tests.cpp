@@ -21,7 +21,11 @@
  ******************************************************************************/
 
 #include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
 #include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/user_interface.h>
 #include <sup/oac-tree/variable_registry.h>
 #include <sup/oac-tree/variables/local_variable.h>
 #include <sup/oac-tree/workspace.h>
@@ -30,6 +34,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
 
 using namespace sup::oac_tree;
 
@@ -358,6 +365,38 @@ TEST_F(WorkspaceTest, RegisterType)
   EXPECT_FALSE(ws.RegisterType(array_type));
 }
 
+TEST_F(WorkspaceTest, ParseTypeAndValue)
+{
+  const std::string type_name = "parse_type_test_name";
+  const std::string json_type = R"({"type":")" + type_name + R"("})";
+  sup::dto::AnyType anytype;
+  EXPECT_FALSE(ws.ParseType(json_type, anytype));
+
+  // Failed parsing is not cached: registering the type allows parsing it
+  sup::dto::AnyType structtype{{{"value", sup::dto::UnsignedInteger16Type}}, type_name};
+  EXPECT_TRUE(ws.RegisterType(structtype));
+  EXPECT_TRUE(ws.ParseType(json_type, anytype));
+  EXPECT_EQ(anytype, structtype);
+
+  // Parsing the same strings again returns independent copies
+  sup::dto::AnyValue value_1;
+  sup::dto::AnyValue value_2;
+  EXPECT_TRUE(ws.ParseValue(json_type, R"({"value":5})", value_1));
+  EXPECT_TRUE(ws.ParseValue(json_type, R"({"value":5})", value_2));
+  EXPECT_EQ(value_1.GetType(), structtype);
+  EXPECT_EQ(value_1["value"].As<sup::dto::uint16>(), 5);
+  value_1["value"] = 7;
+  EXPECT_EQ(value_2["value"].As<sup::dto::uint16>(), 5);
+  sup::dto::AnyValue value_3;
+  EXPECT_TRUE(ws.ParseValue(json_type, R"({"value":5})", value_3));
+  EXPECT_EQ(value_3["value"].As<sup::dto::uint16>(), 5);
+
+  // Invalid strings
+  EXPECT_FALSE(ws.ParseType("{\"type\":", anytype));
+  EXPECT_FALSE(ws.ParseValue(json_type, R"({"value":"five"})", value_1));
+  EXPECT_FALSE(ws.ParseValue("{\"type\":", "5", value_1));
+}
+
 TEST_F(WorkspaceTest, ResetVariable)
 {
   auto variables = ws.VariableNames();
@@ -385,6 +424,294 @@ TEST_F(WorkspaceTest, ResetVariable)
   EXPECT_FALSE(ws.ResetVariable(var2_name));
 }
 
+TEST_F(WorkspaceTest, Reset)
+{
+  const std::string name = "counter";
+  auto var = GlobalVariableRegistry().Create("Local");
+  EXPECT_TRUE(var->AddAttribute(JSON_TYPE_ATTRIBUTE, R"RAW({"type":"uint16"})RAW"));
+  EXPECT_TRUE(var->AddAttribute(JSON_VALUE_ATTRIBUTE, "7"));
+  EXPECT_TRUE(ws.AddVariable(name, std::move(var)));
+
+  // Reset on a workspace that was not setup, sets it up
+  EXPECT_FALSE(ws.IsSuccessfullySetup());
+  ws.Reset();
+  EXPECT_TRUE(ws.IsSuccessfullySetup());
+  sup::dto::AnyValue value;
+  EXPECT_TRUE(ws.GetValue(name, value));
+  EXPECT_EQ(value.As<sup::dto::uint16>(), 7);
+
+  // Reset restores the initial value and notifies it
+  EXPECT_TRUE(ws.SetValue(name, sup::dto::AnyValue{sup::dto::UnsignedInteger16Type, 42}));
+  sup::dto::AnyValue notified_value;
+  EXPECT_TRUE(ws.RegisterGenericCallback(
+      [&](const std::string& var_name, const sup::dto::AnyValue& value, bool)
+      {
+        if (var_name == name)
+        {
+          notified_value = value;
+        }
+      }));
+  ws.Reset();
+  EXPECT_TRUE(ws.GetValue(name, value));
+  EXPECT_EQ(value.As<sup::dto::uint16>(), 7);
+  EXPECT_EQ(notified_value.As<sup::dto::uint16>(), 7);
+
+  // Modifying the value after reset does not affect the next reset
+  EXPECT_TRUE(ws.SetValue(name, sup::dto::AnyValue{sup::dto::UnsignedInteger16Type, 43}));
+  ws.Reset();
+  EXPECT_TRUE(ws.GetValue(name, value));
+  EXPECT_EQ(value.As<sup::dto::uint16>(), 7);
+}
+
+TEST_F(WorkspaceTest, UpdateValue)
+{
+  const std::string name = "counter";
+  auto var = GlobalVariableRegistry().Create("Local");
+  EXPECT_TRUE(var->AddAttribute(JSON_TYPE_ATTRIBUTE, var2_type));
+  EXPECT_TRUE(ws.AddVariable(name, std::move(var)));
+  ws.Setup();
+  auto increment = [](sup::dto::AnyValue& value)
+  {
+    value = value.As<sup::dto::uint64>() + 1;
+    return true;
+  };
+
+  // Update complete value and field
+  EXPECT_TRUE(ws.UpdateValue(name + ".value", increment));
+  sup::dto::AnyValue value;
+  EXPECT_TRUE(ws.GetValue(name + ".value", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 1);
+  EXPECT_TRUE(ws.UpdateValue(name, [](sup::dto::AnyValue& value) {
+    value["status"] = true;
+    return true;
+  }));
+  EXPECT_TRUE(ws.GetValue(name + ".status", value));
+  EXPECT_TRUE(value.As<sup::dto::boolean>());
+
+  // Failing update function does not write
+  EXPECT_FALSE(ws.UpdateValue(name + ".value", [](sup::dto::AnyValue& value) {
+    value = 42;
+    return false;
+  }));
+  EXPECT_TRUE(ws.GetValue(name + ".value", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 1);
+
+  // Unknown variable or field
+  EXPECT_FALSE(ws.UpdateValue("unknown", increment));
+  EXPECT_FALSE(ws.UpdateValue(name + ".unknown", increment));
+
+  // Compare and swap
+  sup::dto::AnyValue one{sup::dto::UnsignedInteger64Type, 1};
+  sup::dto::AnyValue two{sup::dto::UnsignedInteger64Type, 2};
+  EXPECT_FALSE(ws.CompareAndSwap(name + ".value", two, one));
+  EXPECT_TRUE(ws.CompareAndSwap(name + ".value", one, two));
+  EXPECT_TRUE(ws.GetValue(name + ".value", value));
+  EXPECT_EQ(value, two);
+
+  // Concurrent updates are not lost
+  const int n_updates = 1000;
+  auto update_task = [this, &name, &increment, n_updates]() {
+    for (int i = 0; i < n_updates; ++i)
+    {
+      ws.UpdateValue(name + ".value", increment);
+    }
+  };
+  auto task_1 = std::async(std::launch::async, update_task);
+  auto task_2 = std::async(std::launch::async, update_task);
+  task_1.wait();
+  task_2.wait();
+  EXPECT_TRUE(ws.GetValue(name + ".value", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 2 + 2 * n_updates);
+}
+
+TEST_F(WorkspaceTest, Transaction)
+{
+  sup::dto::AnyValue zero{sup::dto::UnsignedInteger64Type, 0};
+  for (const auto& name : { std::string{"a"}, std::string{"b"} })
+  {
+    auto var = GlobalVariableRegistry().Create("Local");
+    EXPECT_TRUE(var->AddAttribute(JSON_TYPE_ATTRIBUTE, R"RAW({"type":"uint64"})RAW"));
+    EXPECT_TRUE(var->AddAttribute(JSON_VALUE_ATTRIBUTE, "0"));
+    EXPECT_TRUE(ws.AddVariable(name, std::move(var)));
+  }
+  ws.Setup();
+  int n_notifications = 0;
+  auto cb_guard = ws.GetCallbackGuard(this);
+  EXPECT_TRUE(ws.RegisterGenericCallback(
+    [&n_notifications](const std::string&, const sup::dto::AnyValue&, bool) {
+      ++n_notifications;
+    }, this));
+  std::vector<std::vector<std::string>> batches;
+  EXPECT_TRUE(ws.RegisterBatchCallback(
+    [&batches](const std::vector<std::string>& names) { batches.push_back(names); }, this));
+
+  // Writes are staged and only visible to the calling thread until commit
+  sup::dto::AnyValue one{sup::dto::UnsignedInteger64Type, 1};
+  sup::dto::AnyValue value;
+  EXPECT_FALSE(ws.HasTransaction());
+  EXPECT_FALSE(ws.CommitTransaction());
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_FALSE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.HasTransaction());
+  EXPECT_TRUE(ws.SetValue("a", one));
+  EXPECT_TRUE(ws.SetValue("a", one));
+  EXPECT_TRUE(ws.UpdateValue("b", [](sup::dto::AnyValue& value) {
+    value = value.As<sup::dto::uint64>() + 2;
+    return true;
+  }));
+  EXPECT_FALSE(ws.SetValue("unknown", one));
+  EXPECT_TRUE(ws.GetValue("a", value));
+  EXPECT_EQ(value, one);
+  auto other_thread_value = std::async(std::launch::async, [this]() {
+    sup::dto::AnyValue result;
+    ws.GetValue("a", result);
+    return result;
+  }).get();
+  EXPECT_EQ(other_thread_value, zero);
+  EXPECT_EQ(n_notifications, 0);
+
+  // Commit writes all values with a single notification per variable and one batch notification
+  EXPECT_TRUE(ws.CommitTransaction());
+  EXPECT_FALSE(ws.HasTransaction());
+  EXPECT_EQ(n_notifications, 2);
+  ASSERT_EQ(batches.size(), 1);
+  EXPECT_EQ(batches[0], std::vector<std::string>({"a", "b"}));
+  EXPECT_TRUE(ws.GetValue("a", value));
+  EXPECT_EQ(value, one);
+  EXPECT_TRUE(ws.GetValue("b", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 2);
+
+  // Abort discards the staged writes
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.SetValue("a", zero));
+  ws.AbortTransaction();
+  EXPECT_TRUE(ws.GetValue("a", value));
+  EXPECT_EQ(value, one);
+  EXPECT_EQ(n_notifications, 2);
+  EXPECT_EQ(batches.size(), 1);
+
+  // Staged values keep the type of the variable and incompatible writes fail immediately
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.SetValue("a", sup::dto::AnyValue{sup::dto::UnsignedInteger8Type, 5}));
+  EXPECT_TRUE(ws.GetValue("a", value));
+  EXPECT_EQ(value.GetType(), sup::dto::UnsignedInteger64Type);
+  EXPECT_FALSE(ws.SetValue("a", sup::dto::AnyValue{"text"}));
+  EXPECT_TRUE(ws.CommitTransaction());
+  EXPECT_TRUE(ws.GetValue("a", value));
+  EXPECT_EQ(value, sup::dto::AnyValue(sup::dto::UnsignedInteger64Type, 5));
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.SetValue("a", one));
+  EXPECT_TRUE(ws.CommitTransaction());
+  EXPECT_EQ(n_notifications, 4);
+  ASSERT_EQ(batches.size(), 3);
+  EXPECT_EQ(batches[2], std::vector<std::string>({"a"}));
+
+  // Commit fails when a variable was modified concurrently
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.SetValue("a", zero));
+  EXPECT_TRUE(ws.SetValue("b", zero));
+  std::async(std::launch::async, [this, &zero]() { ws.SetValue("b", zero); }).wait();
+  EXPECT_EQ(n_notifications, 5);
+  EXPECT_FALSE(ws.CommitTransaction());
+  EXPECT_EQ(n_notifications, 5);
+  EXPECT_EQ(batches.size(), 3);
+  EXPECT_TRUE(ws.GetValue("a", value));
+  EXPECT_EQ(value, one);
+}
+
+TEST_F(WorkspaceTest, TransactionDynamicType)
+{
+  // Staged writes follow the assignment rules of the variable
+  for (const auto& name : { std::string{"dynamic"}, std::string{"static"} })
+  {
+    auto var = GlobalVariableRegistry().Create("Local");
+    EXPECT_TRUE(var->AddAttribute(JSON_TYPE_ATTRIBUTE, R"RAW({"type":"uint64"})RAW"));
+    EXPECT_TRUE(var->AddAttribute(JSON_VALUE_ATTRIBUTE, "0"));
+    EXPECT_TRUE(var->AddAttribute("dynamicType", name == "dynamic" ? "true" : "false"));
+    EXPECT_TRUE(ws.AddVariable(name, std::move(var)));
+  }
+  ws.Setup();
+  sup::dto::AnyValue text{"text"};
+  sup::dto::AnyValue value;
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.SetValue("dynamic", text));
+  EXPECT_FALSE(ws.SetValue("static", text));
+  EXPECT_TRUE(ws.CommitTransaction());
+  EXPECT_TRUE(ws.GetValue("dynamic", value));
+  EXPECT_EQ(value, text);
+  sup::dto::AnyValue static_value;
+  EXPECT_TRUE(ws.GetValue("static", static_value));
+  EXPECT_EQ(static_value.GetType(), sup::dto::UnsignedInteger64Type);
+}
+
+TEST_F(WorkspaceTest, LocalBinding)
+{
+  auto var = GlobalVariableRegistry().Create("Local");
+  EXPECT_TRUE(var->AddAttribute(JSON_TYPE_ATTRIBUTE,
+                                R"RAW({"type":"pair","attributes":[{"x":{"type":"uint64"}}]})RAW"));
+  EXPECT_TRUE(var->AddAttribute(JSON_VALUE_ATTRIBUTE, R"RAW({"x":0})RAW"));
+  EXPECT_TRUE(ws.AddVariable("a", std::move(var)));
+  ws.Setup();
+  int n_notifications = 0;
+  auto cb_guard = ws.GetCallbackGuard(this);
+  EXPECT_TRUE(ws.RegisterGenericCallback(
+    [&n_notifications](const std::string&, const sup::dto::AnyValue&, bool) {
+      ++n_notifications;
+    }, this));
+
+  // Private values are only visible to the calling thread and do not notify
+  sup::dto::AnyValue one{sup::dto::UnsignedInteger64Type, 1};
+  sup::dto::AnyValue value;
+  EXPECT_FALSE(ws.BindLocalValue("unknown", one));
+  EXPECT_FALSE(ws.BindLocalValue("a.y", one));
+  EXPECT_TRUE(ws.BindLocalValue("a.x", one));
+  EXPECT_TRUE(ws.GetValue("a.x", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 1);
+  EXPECT_TRUE(ws.UpdateValue("a.x", [](sup::dto::AnyValue& value) {
+    value = value.As<sup::dto::uint64>() + 2;
+    return true;
+  }));
+  EXPECT_TRUE(ws.GetValue("a.x", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 3);
+  auto other_thread_value = std::async(std::launch::async, [this]() {
+    sup::dto::AnyValue result;
+    ws.GetValue("a.x", result);
+    return result;
+  }).get();
+  EXPECT_EQ(other_thread_value.As<sup::dto::uint64>(), 0);
+  EXPECT_EQ(n_notifications, 0);
+
+  // Bindings take precedence over transactions
+  EXPECT_TRUE(ws.BeginTransaction());
+  EXPECT_TRUE(ws.SetValue("a.x", one));
+  EXPECT_TRUE(ws.CommitTransaction());
+  EXPECT_EQ(n_notifications, 0);
+
+  // After unbinding, the variable itself is visible again
+  ws.UnbindLocalValues();
+  EXPECT_TRUE(ws.GetValue("a.x", value));
+  EXPECT_EQ(value.As<sup::dto::uint64>(), 0);
+}
+
+TEST_F(WorkspaceTest, TickRequests)
+{
+  // Without a request, waiting times out
+  EXPECT_FALSE(ws.WaitForTickRequest(1000000));
+
+  // A pending request is consumed by the next wait
+  ws.RequestTick();
+  EXPECT_TRUE(ws.WaitForTickRequest(1000000));
+  EXPECT_FALSE(ws.WaitForTickRequest(1000000));
+
+  // A request from another thread ends the wait early
+  auto requester = std::async(std::launch::async, [this]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ws.RequestTick();
+  });
+  EXPECT_TRUE(ws.WaitForTickRequest(10000000000));
+  requester.get();
+}
+
 TEST_F(WorkspaceTest, SetupTeardownActions)
 {
   const std::string identifier("server_variable");
@@ -411,6 +738,39 @@ TEST_F(WorkspaceTest, SetupTeardownActions)
   workspace.Teardown();// trigger expectation
 }
 
+TEST_F(WorkspaceTest, SetupTeardownActionsOnProcedureReset)
+{
+  const std::string identifier("server_variable");
+  ::testing::MockFunction<void()> setup_action;
+  ::testing::MockFunction<void()> teardown_action;
+  SetupTeardownActions actions{identifier, setup_action.AsStdFunction(),
+                               teardown_action.AsStdFunction()};
+
+  Procedure proc;
+  proc.PushInstruction(GlobalInstructionRegistry().Create("Succeed"));
+  EXPECT_TRUE(proc.AddVariable("server", std::make_unique<TestServerVariable>(actions)));
+  auto local_var = GlobalVariableRegistry().Create("Local");
+  EXPECT_TRUE(local_var->AddAttribute(JSON_TYPE_ATTRIBUTE, R"RAW({"type":"uint16"})RAW"));
+  EXPECT_TRUE(local_var->AddAttribute(JSON_VALUE_ATTRIBUTE, "7"));
+  EXPECT_TRUE(proc.AddVariable("local", std::move(local_var)));
+
+  // Variables without an in-place reset run the global actions again, local variables don't need
+  // them
+  ::testing::InSequence seq;
+  EXPECT_CALL(setup_action, Call()).Times(1);
+  proc.Setup();
+  EXPECT_CALL(teardown_action, Call()).Times(1);
+  EXPECT_CALL(setup_action, Call()).Times(1);
+  DefaultUserInterface ui;
+  EXPECT_TRUE(proc.GetWorkspace().SetValue("local",
+                                           sup::dto::AnyValue{sup::dto::UnsignedInteger16Type, 8}));
+  proc.Reset(ui);
+  sup::dto::AnyValue value;
+  EXPECT_TRUE(proc.GetWorkspace().GetValue("local", value));
+  EXPECT_EQ(value.As<sup::dto::uint16>(), 7);
+  EXPECT_CALL(teardown_action, Call()).Times(1);
+}
+
 WorkspaceTest::WorkspaceTest()
     : ws{}
     , var1{GlobalVariableRegistry().Create("Local")}